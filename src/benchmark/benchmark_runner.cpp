@@ -0,0 +1,150 @@
+#include "benchmark_runner.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <functional>
+#include <iomanip>
+#include <numeric>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "scheduler/worker_pool.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Escapes the characters that may not appear in JSON strings unescaped
+std::string json_string(const std::string& value) {
+  auto escaped = std::string{"\""};
+  for (const auto character : value) {
+    if (character == '"' || character == '\\') {
+      escaped += '\\';
+      escaped += character;
+    } else if (static_cast<unsigned char>(character) < 0x20) {
+      auto stream = std::ostringstream{};
+      stream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(character);
+      escaped += stream.str();
+    } else {
+      escaped += character;
+    }
+  }
+  return escaped + "\"";
+}
+
+double seconds(const std::chrono::nanoseconds duration) { return std::chrono::duration<double>(duration).count(); }
+
+}  // namespace
+
+BenchmarkState::BenchmarkState(const BenchmarkConfig& config) : _config(config) {}
+
+const BenchmarkConfig& BenchmarkState::config() const { return _config; }
+
+void BenchmarkState::measure(const std::function<void()>& functor) {
+  const auto start_time = std::chrono::steady_clock::now();
+  functor();
+  _durations.push_back(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_time));
+}
+
+void BenchmarkState::set_processed(size_t rows, size_t bytes) {
+  _processed_rows = rows;
+  _processed_bytes = bytes;
+}
+
+const std::vector<std::chrono::nanoseconds>& BenchmarkState::durations() const { return _durations; }
+
+size_t BenchmarkState::processed_rows() const { return _processed_rows; }
+
+size_t BenchmarkState::processed_bytes() const { return _processed_bytes; }
+
+std::chrono::nanoseconds BenchmarkResult::min() const { return *std::min_element(durations.begin(), durations.end()); }
+
+std::chrono::nanoseconds BenchmarkResult::median() const {
+  auto sorted_durations = durations;
+  std::sort(sorted_durations.begin(), sorted_durations.end());
+  return sorted_durations[sorted_durations.size() / 2];
+}
+
+std::chrono::nanoseconds BenchmarkResult::mean() const {
+  return std::accumulate(durations.begin(), durations.end(), std::chrono::nanoseconds{0}) /
+         static_cast<int64_t>(durations.size());
+}
+
+double BenchmarkResult::rows_per_second() const { return static_cast<double>(rows) / seconds(median()); }
+
+double BenchmarkResult::bytes_per_second() const { return static_cast<double>(bytes) / seconds(median()); }
+
+BenchmarkRunner::BenchmarkRunner(BenchmarkConfig config) : _config(std::move(config)) {}
+
+void BenchmarkRunner::add(const std::string& name, std::function<void(BenchmarkState&)> benchmark) {
+  _benchmarks.emplace_back(name, std::move(benchmark));
+}
+
+std::vector<BenchmarkResult> BenchmarkRunner::run(std::ostream& log) const {
+  std::vector<BenchmarkResult> results;
+  for (const auto& benchmark : _benchmarks) {
+    if (benchmark.first.find(_config.filter) == std::string::npos) continue;
+
+    BenchmarkState state(_config);
+    benchmark.second(state);
+    Assert(!state.durations().empty(), "Benchmark " + benchmark.first + " did not measure anything");
+
+    results.push_back(
+        BenchmarkResult{benchmark.first, state.processed_rows(), state.processed_bytes(), state.durations()});
+    const auto& result = results.back();
+    log << std::left << std::setw(48) << result.name << std::right << std::fixed << std::setprecision(3)
+        << std::setw(12) << seconds(result.median()) * 1'000 << " ms" << std::setw(12)
+        << result.rows_per_second() / 1'000'000 << " M rows/s" << std::setw(12) << result.bytes_per_second() / 1'000'000
+        << " MB/s" << std::endl;
+  }
+  return results;
+}
+
+void BenchmarkRunner::write_json(const std::vector<BenchmarkResult>& results, std::ostream& stream) const {
+  const auto now = std::time(nullptr);
+  auto time = std::tm{};
+  gmtime_r(&now, &time);
+  char date[32];
+  std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", &time);
+
+  stream << std::fixed << std::setprecision(2);
+  stream << "{\n";
+  stream << "  \"context\": {\n";
+  stream << "    \"date\": " << json_string(date) << ",\n";
+  stream << "    \"build_type\": " << json_string(IS_DEBUG ? "debug" : "release") << ",\n";
+  stream << "    \"worker_count\": " << WorkerPool::get().worker_count() << ",\n";
+  stream << "    \"row_count\": " << _config.row_count << ",\n";
+  stream << "    \"distinct_count\": " << _config.distinct_count << ",\n";
+  stream << "    \"chunk_size\": " << _config.chunk_size << ",\n";
+  stream << "    \"data_type\": " << json_string(_config.data_type) << ",\n";
+  stream << "    \"selectivity\": " << _config.selectivity << ",\n";
+  stream << "    \"repetitions\": " << _config.repetitions << "\n";
+  stream << "  },\n";
+  stream << "  \"benchmarks\": [";
+  for (auto result_index = size_t{0}; result_index < results.size(); ++result_index) {
+    const auto& result = results[result_index];
+    stream << (result_index == 0 ? "\n" : ",\n");
+    stream << "    {\n";
+    stream << "      \"name\": " << json_string(result.name) << ",\n";
+    stream << "      \"rows\": " << result.rows << ",\n";
+    stream << "      \"bytes\": " << result.bytes << ",\n";
+    stream << "      \"repetitions\": " << result.durations.size() << ",\n";
+    stream << "      \"min_ns\": " << result.min().count() << ",\n";
+    stream << "      \"median_ns\": " << result.median().count() << ",\n";
+    stream << "      \"mean_ns\": " << result.mean().count() << ",\n";
+    stream << "      \"rows_per_second\": " << result.rows_per_second() << ",\n";
+    stream << "      \"bytes_per_second\": " << result.bytes_per_second() << "\n";
+    stream << "    }";
+  }
+  stream << "\n  ]\n}\n";
+}
+
+const BenchmarkConfig& BenchmarkRunner::config() const { return _config; }
+
+}  // namespace opossum
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Parameters of the generated data that all benchmarks share. They are set from the command line.
+struct BenchmarkConfig {
+  // number of rows of the benchmarked tables
+  size_t row_count = 1'000'000;
+  // number of distinct values per column, values are drawn uniformly from them
+  size_t distinct_count = 1'000;
+  uint32_t chunk_size = 100'000;
+  // the data type of the generated columns, see data_types
+  std::string data_type = "int";
+  // fraction of the rows that the benchmarked scans select
+  double selectivity = 0.5;
+  size_t repetitions = 5;
+  // only benchmarks whose name contains the filter are run
+  std::string filter;
+  // temporary file for the load_table benchmarks
+  std::string scratch_file = "/tmp/hyrise_benchmark.tbl";
+  // the JSON results are written to this file, nothing is written if it is empty
+  std::string output_file;
+};
+
+// Is passed to each benchmark. A benchmark prepares its input, calls measure once per repetition, and reports how much
+// data a single repetition processed.
+class BenchmarkState {
+ public:
+  explicit BenchmarkState(const BenchmarkConfig& config);
+
+  const BenchmarkConfig& config() const;
+
+  // executes and times one repetition of the benchmark. Everything outside of the functor is not measured.
+  void measure(const std::function<void()>& functor);
+
+  // sets the number of rows and bytes that one repetition processes, used to compute the throughput
+  void set_processed(size_t rows, size_t bytes);
+
+  const std::vector<std::chrono::nanoseconds>& durations() const;
+  size_t processed_rows() const;
+  size_t processed_bytes() const;
+
+ protected:
+  const BenchmarkConfig& _config;
+  std::vector<std::chrono::nanoseconds> _durations;
+  size_t _processed_rows = 0;
+  size_t _processed_bytes = 0;
+};
+
+struct BenchmarkResult {
+  std::string name;
+  size_t rows;
+  size_t bytes;
+  std::vector<std::chrono::nanoseconds> durations;
+
+  std::chrono::nanoseconds min() const;
+  std::chrono::nanoseconds median() const;
+  std::chrono::nanoseconds mean() const;
+
+  // the throughput is computed from the median duration, which is robust against single outliers
+  double rows_per_second() const;
+  double bytes_per_second() const;
+};
+
+// Holds the registered benchmarks and runs those that match the filter of the config
+class BenchmarkRunner {
+ public:
+  explicit BenchmarkRunner(BenchmarkConfig config);
+
+  void add(const std::string& name, std::function<void(BenchmarkState&)> benchmark);
+
+  // runs the benchmarks in the order they were added and prints a summary line for each of them
+  std::vector<BenchmarkResult> run(std::ostream& log) const;
+
+  // writes the results together with the config and the build type as JSON
+  void write_json(const std::vector<BenchmarkResult>& results, std::ostream& stream) const;
+
+  const BenchmarkConfig& config() const;
+
+ protected:
+  const BenchmarkConfig _config;
+  std::vector<std::pair<std::string, std::function<void(BenchmarkState&)>>> _benchmarks;
+};
+
+}  // namespace opossum
@@ -0,0 +1,82 @@
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "benchmark_runner.hpp"
+#include "micro_benchmarks.hpp"
+
+namespace {
+
+void print_usage(const char* binary) {
+  std::cerr << "Usage: " << binary << " [options]\n"
+            << "  --rows=N           number of rows of the benchmarked tables\n"
+            << "  --distinct=N       number of distinct values per column\n"
+            << "  --chunk-size=N     maximum number of rows per chunk\n"
+            << "  --type=TYPE        data type of the generated column (int, long, float, double, string)\n"
+            << "  --selectivity=F    fraction of the rows that the scans select\n"
+            << "  --repetitions=N    number of measured runs per benchmark\n"
+            << "  --filter=NAME      only run benchmarks whose name contains NAME\n"
+            << "  --scratch-file=F   temporary file for the load_table benchmarks\n"
+            << "  --output=FILE      write the results as JSON to FILE (- for stdout)\n";
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  auto config = opossum::BenchmarkConfig{};
+
+  for (auto argument_index = 1; argument_index < argc; ++argument_index) {
+    const auto argument = std::string{argv[argument_index]};
+    const auto separator = argument.find('=');
+    const auto option = argument.substr(0, separator);
+    const auto value = separator == std::string::npos ? std::string{} : argument.substr(separator + 1);
+
+    try {
+      if (option == "--rows") {
+        config.row_count = std::stoull(value);
+      } else if (option == "--distinct") {
+        config.distinct_count = std::stoull(value);
+      } else if (option == "--chunk-size") {
+        config.chunk_size = static_cast<uint32_t>(std::stoul(value));
+      } else if (option == "--type") {
+        config.data_type = value;
+      } else if (option == "--selectivity") {
+        config.selectivity = std::stod(value);
+      } else if (option == "--repetitions") {
+        config.repetitions = std::stoull(value);
+      } else if (option == "--filter") {
+        config.filter = value;
+      } else if (option == "--scratch-file") {
+        config.scratch_file = value;
+      } else if (option == "--output") {
+        config.output_file = value;
+      } else {
+        print_usage(argv[0]);
+        return option == "--help" ? 0 : 1;
+      }
+    } catch (const std::exception&) {
+      std::cerr << "Invalid value for " << option << ": " << value << std::endl;
+      return 1;
+    }
+  }
+
+  if (config.repetitions == 0 || config.chunk_size == 0) {
+    std::cerr << "--repetitions and --chunk-size have to be positive" << std::endl;
+    return 1;
+  }
+  if (IS_DEBUG) std::cerr << "Warning: this is a debug build, its numbers are not meaningful" << std::endl;
+
+  auto runner = opossum::BenchmarkRunner{config};
+  opossum::register_micro_benchmarks(runner);
+  const auto results = runner.run(std::cerr);
+
+  if (config.output_file == "-") {
+    runner.write_json(results, std::cout);
+  } else if (!config.output_file.empty()) {
+    auto file = std::ofstream{config.output_file};
+    runner.write_json(results, file);
+  }
+
+  return 0;
+}
@@ -0,0 +1,368 @@
+#include "micro_benchmarks.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "benchmark_runner.hpp"
+#include "operators/aggregate.hpp"
+#include "operators/pipeline.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "resolve_type.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/binary_table.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Keeps the compiler from optimizing away the computation of a value that is not used otherwise
+template <typename T>
+void do_not_optimize(const T& value) {
+  asm volatile("" : : "g"(&value) : "memory");
+}
+
+// Returns the value_index-th smallest of the generated values. Strings are zero-padded so that they sort like numbers.
+template <typename T>
+T value_for(const size_t value_index) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    auto stream = std::ostringstream{};
+    stream << "value" << std::setw(10) << std::setfill('0') << value_index;
+    return stream.str();
+  } else {
+    return static_cast<T>(value_index);
+  }
+}
+
+// Generates the values of a column with config.distinct_count uniformly distributed values. The seed is fixed so that
+// all runs benchmark the same data.
+template <typename T>
+std::vector<T> generate_values(const BenchmarkConfig& config) {
+  auto generator = std::mt19937_64{42};
+  auto distribution = std::uniform_int_distribution<size_t>{0, std::max(config.distinct_count, size_t{1}) - 1};
+
+  std::vector<T> values;
+  values.reserve(config.row_count);
+  for (auto row = size_t{0}; row < config.row_count; ++row) values.push_back(value_for<T>(distribution(generator)));
+  return values;
+}
+
+template <typename T>
+size_t value_bytes(const std::vector<T>& values) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    auto bytes = size_t{0};
+    for (const auto& value : values) bytes += value.size();
+    return bytes;
+  } else {
+    return values.size() * sizeof(T);
+  }
+}
+
+// Returns the value below which config.selectivity of the generated values lie
+template <typename T>
+T search_value(const BenchmarkConfig& config) {
+  return value_for<T>(static_cast<size_t>(static_cast<double>(config.distinct_count) * config.selectivity));
+}
+
+template <typename T>
+std::shared_ptr<Table> generate_table(const BenchmarkConfig& config, const std::vector<T>& values) {
+  auto table = std::make_shared<Table>(config.chunk_size);
+  table->add_column("a", config.data_type);
+  table->append_columns({AllTypeVector{values}});
+  return table;
+}
+
+// Resolves the data type of the config, generates the values, and passes them to the benchmark
+template <typename Benchmark>
+std::function<void(BenchmarkState&)> with_values(const Benchmark& benchmark) {
+  return [benchmark](BenchmarkState& state) {
+    resolve_data_type(state.config().data_type, [&](auto type) {
+      using Type = typename decltype(type)::type;
+      const auto values = generate_values<Type>(state.config());
+      state.set_processed(values.size(), value_bytes(values));
+      benchmark(state, values);
+    });
+  };
+}
+
+void register_table_benchmarks(BenchmarkRunner& runner) {
+  runner.add("Table::append", with_values([](BenchmarkState& state, const auto& values) {
+               for (auto repetition = size_t{0}; repetition < state.config().repetitions; ++repetition) {
+                 auto table = std::make_shared<Table>(state.config().chunk_size);
+                 table->add_column("a", state.config().data_type);
+                 state.measure([&]() {
+                   for (const auto& value : values) table->append({value});
+                 });
+               }
+             }));
+
+  runner.add("Table::append_columns", with_values([](BenchmarkState& state, const auto& values) {
+               for (auto repetition = size_t{0}; repetition < state.config().repetitions; ++repetition) {
+                 auto table = std::make_shared<Table>(state.config().chunk_size);
+                 table->add_column("a", state.config().data_type);
+                 auto columns = std::vector<AllTypeVector>{AllTypeVector{values}};
+                 state.measure([&]() { table->append_columns(std::move(columns)); });
+               }
+             }));
+
+  // Non-integer columns fall back to dictionary encoding with FrameOfReference
+  const auto encoding_specs = std::vector<std::pair<SegmentEncodingSpec, std::string>>{
+      {AttributeVectorEncoding::FixedSize, "FixedSize"},
+      {AttributeVectorEncoding::BitPacked, "BitPacked"},
+      {SegmentEncoding::RunLength, "RunLength"},
+      {SegmentEncoding::FrameOfReference, "FrameOfReference"}};
+  for (const auto& encoding_spec : encoding_specs) {
+    const auto spec = encoding_spec.first;
+    runner.add("Table::compress_chunk/" + encoding_spec.second,
+               with_values([spec](BenchmarkState& state, const auto& values) {
+                 for (auto repetition = size_t{0}; repetition < state.config().repetitions; ++repetition) {
+                   const auto table = generate_table(state.config(), values);
+                   state.measure([&]() {
+                     for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+                       table->compress_chunk(chunk_id, spec);
+                     }
+                   });
+                 }
+               }));
+  }
+
+  for (const auto encoding : {AttributeVectorEncoding::FixedSize, AttributeVectorEncoding::BitPacked}) {
+    const auto suffix = std::string{encoding == AttributeVectorEncoding::FixedSize ? "FixedSize" : "BitPacked"};
+
+    // Compresses a single segment of chunk_size rows
+    runner.add("DictionarySegment::DictionarySegment/" + suffix,
+               with_values([encoding](BenchmarkState& state, const auto& values) {
+                 using Type = typename std::decay_t<decltype(values)>::value_type;
+                 const auto row_count = std::min(values.size(), size_t{state.config().chunk_size});
+                 auto segment_values = std::vector<Type>(values.begin(), values.begin() + row_count);
+                 const auto segment = std::make_shared<ValueSegment<Type>>(std::move(segment_values));
+                 state.set_processed(row_count, value_bytes(segment->values()));
+
+                 for (auto repetition = size_t{0}; repetition < state.config().repetitions; ++repetition) {
+                   state.measure([&]() { do_not_optimize(DictionarySegment<Type>(segment, encoding)); });
+                 }
+               }));
+  }
+}
+
+void register_segment_access_benchmarks(BenchmarkRunner& runner) {
+  // Counts the values below the search value, once through the virtual operator[] and once through segment_iterate
+  for (const auto compress : {false, true}) {
+    const auto prefix = std::string{compress ? "DictionarySegment" : "ValueSegment"};
+
+    runner.add(prefix + "::operator[]", with_values([compress](BenchmarkState& state, const auto& values) {
+                 using Type = typename std::decay_t<decltype(values)>::value_type;
+                 const auto table = generate_table(state.config(), values);
+                 if (compress) table->compress_table();
+                 const auto search = search_value<Type>(state.config());
+
+                 for (auto repetition = size_t{0}; repetition < state.config().repetitions; ++repetition) {
+                   state.measure([&]() {
+                     auto count = size_t{0};
+                     for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+                       const auto& segment = *table->get_chunk(chunk_id)->get_segment(ColumnID{0});
+                       for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment.size(); ++chunk_offset) {
+                         if (boost::get<Type>(segment[chunk_offset]) < search) ++count;
+                       }
+                     }
+                     do_not_optimize(count);
+                   });
+                 }
+               }));
+
+    runner.add(prefix + "/segment_iterate", with_values([compress](BenchmarkState& state, const auto& values) {
+                 using Type = typename std::decay_t<decltype(values)>::value_type;
+                 const auto table = generate_table(state.config(), values);
+                 if (compress) table->compress_table();
+                 const auto search = search_value<Type>(state.config());
+
+                 for (auto repetition = size_t{0}; repetition < state.config().repetitions; ++repetition) {
+                   state.measure([&]() {
+                     auto count = size_t{0};
+                     for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+                       segment_iterate<Type>(*table->get_chunk(chunk_id)->get_segment(ColumnID{0}),
+                                             [&](const Type& value, const ChunkOffset) {
+                                               if (value < search) ++count;
+                                             });
+                     }
+                     do_not_optimize(count);
+                   });
+                 }
+               }));
+  }
+}
+
+void register_table_scan_benchmarks(BenchmarkRunner& runner) {
+  enum class ScanInput {
+    ValueSegment,
+    FixedSizeDictionary,
+    BitPackedDictionary,
+    RunLength,
+    FrameOfReference,
+    ReferenceSegment
+  };
+  const auto inputs = std::vector<std::pair<ScanInput, std::string>>{
+      {ScanInput::ValueSegment, "ValueSegment"},
+      {ScanInput::FixedSizeDictionary, "DictionarySegment/FixedSize"},
+      {ScanInput::BitPackedDictionary, "DictionarySegment/BitPacked"},
+      {ScanInput::RunLength, "RunLengthSegment"},
+      {ScanInput::FrameOfReference, "FrameOfReferenceSegment"},
+      {ScanInput::ReferenceSegment, "ReferenceSegment"}};
+
+  for (const auto& input : inputs) {
+    const auto scan_input = input.first;
+    runner.add("TableScan/" + input.second, with_values([scan_input](BenchmarkState& state, const auto& values) {
+                 using Type = typename std::decay_t<decltype(values)>::value_type;
+                 const auto table = generate_table(state.config(), values);
+                 if (scan_input == ScanInput::FixedSizeDictionary) table->compress_table();
+                 if (scan_input == ScanInput::BitPackedDictionary) {
+                   table->compress_table(AttributeVectorEncoding::BitPacked);
+                 }
+                 if (scan_input == ScanInput::RunLength) table->compress_table(SegmentEncoding::RunLength);
+                 if (scan_input == ScanInput::FrameOfReference) {
+                   table->compress_table(SegmentEncoding::FrameOfReference);
+                 }
+
+                 std::shared_ptr<const AbstractOperator> input_operator = std::make_shared<TableWrapper>(table);
+                 std::const_pointer_cast<AbstractOperator>(input_operator)->execute();
+                 if (scan_input == ScanInput::ReferenceSegment) {
+                   // Selects all rows, so that the benchmarked scan processes as many rows as the others
+                   auto reference_scan = std::make_shared<TableScan>(input_operator, ColumnID{0},
+                                                                     ScanType::OpGreaterThanEquals, value_for<Type>(0));
+                   reference_scan->execute();
+                   input_operator = reference_scan;
+                 }
+
+                 const auto search = search_value<Type>(state.config());
+                 for (auto repetition = size_t{0}; repetition < state.config().repetitions; ++repetition) {
+                   auto scan = std::make_shared<TableScan>(input_operator, ColumnID{0}, ScanType::OpLessThan, search);
+                   state.measure([&]() { scan->execute(); });
+                 }
+               }));
+  }
+}
+
+void register_aggregate_benchmarks(BenchmarkRunner& runner) {
+  // Groups by the generated column, once hashing its values and once using the ValueIDs of its dictionaries
+  for (const auto compress : {false, true}) {
+    const auto suffix = std::string{compress ? "DictionarySegment" : "ValueSegment"};
+    runner.add("Aggregate/" + suffix, with_values([compress](BenchmarkState& state, const auto& values) {
+                 const auto table = generate_table(state.config(), values);
+                 if (compress) table->compress_table();
+                 auto input_operator = std::make_shared<TableWrapper>(table);
+                 input_operator->execute();
+
+                 for (auto repetition = size_t{0}; repetition < state.config().repetitions; ++repetition) {
+                   auto aggregate = std::make_shared<Aggregate>(
+                       input_operator, std::vector<AggregateColumnDefinition>{{std::nullopt, AggregateFunction::Count}},
+                       std::vector<ColumnID>{ColumnID{0}});
+                   state.measure([&]() { aggregate->execute(); });
+                 }
+               }));
+  }
+}
+
+void register_sort_benchmarks(BenchmarkRunner& runner) {
+  // Sorts by the generated column, once encoding each value and once encoding each dictionary entry
+  for (const auto compress : {false, true}) {
+    const auto suffix = std::string{compress ? "DictionarySegment" : "ValueSegment"};
+    runner.add("Sort/" + suffix, with_values([compress](BenchmarkState& state, const auto& values) {
+                 const auto table = generate_table(state.config(), values);
+                 if (compress) table->compress_table();
+                 auto input_operator = std::make_shared<TableWrapper>(table);
+                 input_operator->execute();
+
+                 for (auto repetition = size_t{0}; repetition < state.config().repetitions; ++repetition) {
+                   auto sort = std::make_shared<Sort>(input_operator, std::vector<SortColumnDefinition>{{ColumnID{0}}});
+                   state.measure([&]() { sort->execute(); });
+                 }
+               }));
+  }
+}
+
+void register_pipeline_benchmarks(BenchmarkRunner& runner) {
+  // Scans the generated column and counts the matching rows per value, once materializing the scan result and once
+  // pushing each chunk through both operators
+  for (const auto pipelined : {false, true}) {
+    const auto suffix = std::string{pipelined ? "Pipelined" : "OperatorAtATime"};
+    runner.add("ScanAggregate/" + suffix, with_values([pipelined](BenchmarkState& state, const auto& values) {
+                 using Type = typename std::decay_t<decltype(values)>::value_type;
+                 const auto table = generate_table(state.config(), values);
+                 auto input_operator = std::make_shared<TableWrapper>(table);
+                 input_operator->execute();
+
+                 const auto search = search_value<Type>(state.config());
+                 for (auto repetition = size_t{0}; repetition < state.config().repetitions; ++repetition) {
+                   auto scan = std::make_shared<TableScan>(input_operator, ColumnID{0}, ScanType::OpLessThan, search);
+                   auto aggregate = std::make_shared<Aggregate>(
+                       scan, std::vector<AggregateColumnDefinition>{{std::nullopt, AggregateFunction::Count}},
+                       std::vector<ColumnID>{ColumnID{0}});
+                   auto pipeline = std::make_shared<Pipeline>(aggregate);
+                   state.measure([&]() {
+                     if (pipelined) {
+                       pipeline->execute();
+                     } else {
+                       scan->execute();
+                       aggregate->execute();
+                     }
+                   });
+                 }
+               }));
+  }
+}
+
+void register_load_table_benchmarks(BenchmarkRunner& runner) {
+  runner.add("load_table", with_values([](BenchmarkState& state, const auto& values) {
+               const auto& file_name = state.config().scratch_file;
+               {
+                 auto file = std::ofstream{file_name};
+                 file << "a\n" << state.config().data_type << "\n";
+                 for (const auto& value : values) file << value << "\n";
+               }
+               state.set_processed(values.size(), static_cast<size_t>(std::ifstream{file_name, std::ios::ate}.tellg()));
+
+               for (auto repetition = size_t{0}; repetition < state.config().repetitions; ++repetition) {
+                 state.measure([&]() { do_not_optimize(load_table(file_name, state.config().chunk_size)); });
+               }
+               std::remove(file_name.c_str());
+             }));
+
+  runner.add("load_binary_table", with_values([](BenchmarkState& state, const auto& values) {
+               const auto file_name = state.config().scratch_file + ".bin";
+               generate_table(state.config(), values)->save(file_name);
+               state.set_processed(values.size(), static_cast<size_t>(std::ifstream{file_name, std::ios::ate}.tellg()));
+
+               for (auto repetition = size_t{0}; repetition < state.config().repetitions; ++repetition) {
+                 state.measure([&]() { do_not_optimize(load_binary_table(file_name)); });
+               }
+               std::remove(file_name.c_str());
+             }));
+}
+
+}  // namespace
+
+void register_micro_benchmarks(BenchmarkRunner& runner) {
+  register_table_benchmarks(runner);
+  register_segment_access_benchmarks(runner);
+  register_table_scan_benchmarks(runner);
+  register_aggregate_benchmarks(runner);
+  register_sort_benchmarks(runner);
+  register_pipeline_benchmarks(runner);
+  register_load_table_benchmarks(runner);
+}
+
+}  // namespace opossum
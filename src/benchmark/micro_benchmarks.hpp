@@ -0,0 +1,11 @@
+#pragma once
+
+namespace opossum {
+
+class BenchmarkRunner;
+
+// Registers the benchmarks of the storage layer (appending, compressing, and accessing segments), of TableScan for
+// each segment type, of Aggregate and Sort, of pipelined execution, and of loading tables from files
+void register_micro_benchmarks(BenchmarkRunner& runner);
+
+}  // namespace opossum
@@ -15,6 +15,7 @@
 #include <boost/preprocessor/seq/transform.hpp>
 
 #include <cstdint>
+#include <ostream>
 #include <string>
 #include <vector>
 
@@ -24,6 +25,16 @@ namespace opossum {
 
 namespace hana = boost::hana;
 
+// Represents a missing value, e.g., in the right columns of a left outer join for rows without a join partner. It is
+// not one of the data types, so segments cannot store it. Like in SQL, it is smaller than all other values when sorting
+// AllTypeVariants, but equal to no value when scanning or joining.
+struct NullValue {};
+
+inline bool operator==(const NullValue&, const NullValue&) { return true; }
+inline bool operator!=(const NullValue&, const NullValue&) { return false; }
+inline bool operator<(const NullValue&, const NullValue&) { return false; }
+inline std::ostream& operator<<(std::ostream& stream, const NullValue&) { return stream << "NULL"; }
+
 namespace detail {
 
 #define EXPAND_TO_HANA_TYPE(s, data, elem) boost::hana::type_c<elem>
@@ -60,8 +71,18 @@ static constexpr auto data_types = hana::transform(data_types_as_tuples, to_pair
 // Converts tuple to mpl vector
 using TypesAsMplVector = decltype(hana::to<hana::ext::boost::mpl::vector_tag>(types));
 
-// Creates boost::variant from mpl vector
-using AllTypeVariant = typename boost::make_variant_over<detail::TypesAsMplVector>::type;
+// Creates boost::variant from mpl vector, NullValue comes first so that default-constructed variants are NULL
+using AllTypeVariant =
+    typename boost::make_variant_over<boost::mpl::push_front<detail::TypesAsMplVector, NullValue>::type>::type;
+
+// Equivalent to hana::make_tuple(hana::type_c<std::vector<int32_t>>, hana::type_c<std::vector<int64_t>>, ...);
+static constexpr auto vector_types = hana::transform(  // NOLINT
+    types, [](auto type) { return hana::type_c<std::vector<typename decltype(type)::type>>; });
+
+using VectorTypesAsMplVector = decltype(hana::to<hana::ext::boost::mpl::vector_tag>(vector_types));
+
+// Creates boost::variant of vectors from mpl vector
+using AllTypeVector = typename boost::make_variant_over<detail::VectorTypesAsMplVector>::type;
 
 }  // namespace detail
 
@@ -70,6 +91,13 @@ static constexpr auto data_types = detail::data_types;
 
 using AllTypeVariant = detail::AllTypeVariant;
 
+static const auto NULL_VALUE = AllTypeVariant{};
+
+inline bool variant_is_null(const AllTypeVariant& value) { return value.which() == 0; }
+
+// Holds a std::vector of values of any of the data types, e.g., all values of a column that are appended at once
+using AllTypeVector = detail::AllTypeVector;
+
 /**
  * @defgroup Macros for explicitly instantiating template classes
  *
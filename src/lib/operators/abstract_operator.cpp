@@ -1,20 +1,88 @@
 #include "abstract_operator.hpp"
 
 #include <chrono>
+#include <ctime>
 #include <memory>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
+#include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
+namespace {
+
+std::chrono::nanoseconds process_cpu_time() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::duration<double>(static_cast<double>(std::clock()) / CLOCKS_PER_SEC));
+}
+
+// Calls the functor with each segment of the table and, for ReferenceSegments, with the position list
+template <typename Functor>
+void for_each_buffer(const Table& table, const Functor& functor) {
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+      const auto segment = chunk->get_segment(column_id);
+      const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment);
+      functor(*segment, reference_segment ? reference_segment->pos_list().get() : nullptr);
+    }
+  }
+}
+
+// Returns the bytes of the output that are not shared with the inputs. Segments and position lists that are shared
+// among the output columns are counted once.
+uint64_t output_bytes(const Table& output, const std::vector<std::shared_ptr<const Table>>& inputs) {
+  std::unordered_set<const void*> known_buffers;
+  for (const auto& input : inputs) {
+    for_each_buffer(*input, [&](const BaseSegment& segment, const PosList* pos_list) {
+      known_buffers.insert(pos_list ? static_cast<const void*>(pos_list) : &segment);
+    });
+  }
+
+  auto bytes = uint64_t{0};
+  for_each_buffer(output, [&](const BaseSegment& segment, const PosList* pos_list) {
+    if (known_buffers.insert(pos_list ? static_cast<const void*>(pos_list) : &segment).second) {
+      bytes += segment.estimate_memory_usage();
+    }
+  });
+  return bytes;
+}
+
+}  // namespace
+
 AbstractOperator::AbstractOperator(const std::shared_ptr<const AbstractOperator> left,
                                    const std::shared_ptr<const AbstractOperator> right)
     : _input_left(left), _input_right(right) {}
 
-void AbstractOperator::execute() { _output = _on_execute(); }
+void AbstractOperator::execute() {
+  const auto walltime_begin = std::chrono::steady_clock::now();
+  const auto cpu_time_begin = process_cpu_time();
+
+  _output = _on_execute();
+
+  _performance_data = OperatorPerformanceData{};
+  _performance_data.executed = true;
+  _performance_data.walltime = std::chrono::steady_clock::now() - walltime_begin;
+  _performance_data.cpu_time = process_cpu_time() - cpu_time_begin;
+
+  std::vector<std::shared_ptr<const Table>> inputs;
+  if (_input_left) {
+    inputs.push_back(_input_table_left());
+    _performance_data.input_row_count_left = inputs.back()->row_count();
+  }
+  if (_input_right) {
+    inputs.push_back(_input_table_right());
+    _performance_data.input_row_count_right = inputs.back()->row_count();
+  }
+  _performance_data.output_row_count = _output->row_count();
+  _performance_data.output_chunk_count = _output->chunk_count();
+  // Operators without inputs (e.g., GetTable) return stored tables, which they did not allocate
+  if (!inputs.empty()) _performance_data.output_bytes = output_bytes(*_output, inputs);
+}
 
 std::shared_ptr<const Table> AbstractOperator::get_output() const {
   // TODO(anyone): You should place some meaningful checks here
@@ -22,6 +90,14 @@ std::shared_ptr<const Table> AbstractOperator::get_output() const {
   return _output;
 }
 
+std::shared_ptr<const AbstractOperator> AbstractOperator::input_left() const { return _input_left; }
+
+std::shared_ptr<const AbstractOperator> AbstractOperator::input_right() const { return _input_right; }
+
+std::string AbstractOperator::description() const { return name(); }
+
+const OperatorPerformanceData& AbstractOperator::performance_data() const { return _performance_data; }
+
 std::shared_ptr<const Table> AbstractOperator::_input_table_left() const { return _input_left->get_output(); }
 
 std::shared_ptr<const Table> AbstractOperator::_input_table_right() const { return _input_right->get_output(); }
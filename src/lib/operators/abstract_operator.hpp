@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <string>
 #include <vector>
@@ -24,6 +25,26 @@ class Table;
 //
 // Find more information about operators in our Wiki: https://github.com/hyrise/hyrise/wiki/operator-concept
 
+// Measurements that execute() takes for every operator. See explain() for printing them for a whole query plan.
+struct OperatorPerformanceData {
+  bool executed = false;
+
+  std::chrono::nanoseconds walltime{0};
+
+  // CPU time of the whole process during the execution. This includes the jobs that the operator ran on the
+  // WorkerPool, but also the work of other operators that were executed at the same time.
+  std::chrono::nanoseconds cpu_time{0};
+
+  uint64_t input_row_count_left = 0;
+  uint64_t input_row_count_right = 0;
+  uint64_t output_row_count = 0;
+  uint64_t output_chunk_count = 0;
+
+  // bytes of the output's segments and position lists that are not shared with the inputs, i.e., the memory that the
+  // operator allocated for its result
+  uint64_t output_bytes = 0;
+};
+
 class AbstractOperator : private Noncopyable {
  public:
   AbstractOperator(const std::shared_ptr<const AbstractOperator> left = nullptr,
@@ -45,6 +66,15 @@ class AbstractOperator : private Noncopyable {
   std::shared_ptr<const AbstractOperator> input_left() const;
   std::shared_ptr<const AbstractOperator> input_right() const;
 
+  // returns the name of the operator, e.g., "TableScan"
+  virtual const std::string name() const = 0;
+
+  // returns the name and the parameters of the operator, e.g., "TableScan (#0 > 5)"
+  virtual std::string description() const;
+
+  // returns the measurements of the last execution
+  const OperatorPerformanceData& performance_data() const;
+
  protected:
   // abstract method to actually execute the operator
   // execute and get_output are split into two methods to allow for easier
@@ -60,6 +90,8 @@ class AbstractOperator : private Noncopyable {
 
   // Is nullptr until the operator is executed
   std::shared_ptr<const Table> _output;
+
+  OperatorPerformanceData _performance_data;
 };
 
 }  // namespace opossum
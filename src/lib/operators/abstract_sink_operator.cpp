@@ -0,0 +1,15 @@
+#include "abstract_sink_operator.hpp"
+
+#include <memory>
+
+#include "storage/table.hpp"
+
+namespace opossum {
+
+std::shared_ptr<const Table> AbstractSinkOperator::_on_execute() {
+  const auto input_table = _input_table_left();
+  return consume(input_table, input_table->chunk_count(),
+                 [&](const ChunkID chunk_id) { return make_morsel(input_table, chunk_id); });
+}
+
+}  // namespace opossum
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_operator.hpp"
+#include "abstract_streaming_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// Operators that consume their input chunk by chunk, but can only produce their output once all chunks are consumed
+// (e.g., Aggregate). Such an operator can terminate a pipeline: the morsels of the pipeline are then consumed as soon
+// as they are produced, without ever materializing the input of the sink.
+class AbstractSinkOperator : public AbstractOperator {
+ public:
+  using AbstractOperator::AbstractOperator;
+
+  // Consumes morsel_count morsels whose columns are those of input_table and returns the output. The morsels have to
+  // be requested from the producer, which should be done in parallel jobs.
+  virtual std::shared_ptr<const Table> consume(const std::shared_ptr<const Table>& input_table,
+                                               const ChunkID morsel_count, const MorselProducer& producer) const = 0;
+
+ protected:
+  // Consumes the chunks of the input table
+  std::shared_ptr<const Table> _on_execute() override;
+};
+
+}  // namespace opossum
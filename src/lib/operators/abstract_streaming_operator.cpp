@@ -0,0 +1,50 @@
+#include "abstract_streaming_operator.hpp"
+
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "scheduler/worker_pool.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+Morsel make_morsel(const std::shared_ptr<const Table>& table, const ChunkID chunk_id) {
+  Morsel morsel{Chunk{}, table, chunk_id, {}};
+  const auto chunk = table->get_chunk(chunk_id);
+  for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+    morsel.chunk.add_segment(chunk->get_segment(column_id), chunk->statistics(column_id));
+  }
+  for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+    morsel.column_ids.push_back(column_id);
+  }
+  return morsel;
+}
+
+std::shared_ptr<const Table> materialize_morsels(const std::shared_ptr<Table>& output_table, const ChunkID morsel_count,
+                                                 const MorselProducer& producer) {
+  std::vector<Chunk> chunks(morsel_count);
+  std::vector<std::function<void()>> jobs;
+  for (auto chunk_id = ChunkID{0}; chunk_id < morsel_count; ++chunk_id) {
+    jobs.emplace_back([&, chunk_id]() { chunks[chunk_id] = std::move(producer(chunk_id).chunk); });
+  }
+  WorkerPool::get().run_and_wait(jobs);
+
+  for (auto& chunk : chunks) {
+    if (chunk.size() > 0) output_table->emplace_chunk(std::move(chunk));
+  }
+  // Even if no row remains, the output has to contain (empty) segments for all columns
+  if (output_table->row_count() == 0 && !chunks.empty()) output_table->emplace_chunk(std::move(chunks.front()));
+
+  return output_table;
+}
+
+std::shared_ptr<const Table> AbstractStreamingOperator::_on_execute() {
+  const auto input_table = _input_table_left();
+  return materialize_morsels(output_definition(*input_table), input_table->chunk_count(), [&](const ChunkID chunk_id) {
+    return process_morsel(*input_table, make_morsel(input_table, chunk_id));
+  });
+}
+
+}  // namespace opossum
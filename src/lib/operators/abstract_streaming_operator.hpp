@@ -0,0 +1,62 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "storage/chunk.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// A morsel is one chunk of rows on its way through a pipeline of operators (see Pipeline). Each morsel stems from one
+// chunk of the pipeline's input table.
+//
+// Segments other than ReferenceSegments are shared with that input chunk, possibly reordered by a Projection. An
+// operator that references them (e.g., TableScan) has to point to the table that stores them, which is why the morsel
+// keeps track of where its columns come from.
+struct Morsel {
+  Chunk chunk;
+
+  // the table and chunk that the segments of the morsel are stored in
+  std::shared_ptr<const Table> table;
+  ChunkID chunk_id;
+
+  // the column of table that each column of the morsel is stored in
+  std::vector<ColumnID> column_ids;
+};
+
+// Returns the morsel for the given input chunk. Producers are called concurrently from jobs on the WorkerPool.
+using MorselProducer = std::function<Morsel(const ChunkID)>;
+
+// Returns a morsel that shares the segments of a chunk of the table
+Morsel make_morsel(const std::shared_ptr<const Table>& table, const ChunkID chunk_id);
+
+// Produces all morsels in parallel and adds their chunks to the output table, which holds no chunks yet. Empty
+// chunks are skipped, but the output keeps the first one if no chunk holds any rows.
+std::shared_ptr<const Table> materialize_morsels(const std::shared_ptr<Table>& output_table, const ChunkID morsel_count,
+                                                 const MorselProducer& producer);
+
+// Operators that process each chunk of their input independently of the others, so that the output chunk of one input
+// chunk can be passed on to the next operator right away. Such operators can be fused into a pipeline.
+class AbstractStreamingOperator : public AbstractOperator {
+ public:
+  using AbstractOperator::AbstractOperator;
+
+  // Returns a table without rows whose columns are those of the output if the input has the columns of input_table.
+  // Invalid parameters (e.g., unknown columns) are reported here, so that they are detected before any morsel is
+  // processed.
+  virtual std::shared_ptr<Table> output_definition(const Table& input_table) const = 0;
+
+  // Processes one morsel whose columns are those of input_table. This is called concurrently for different morsels.
+  virtual Morsel process_morsel(const Table& input_table, Morsel morsel) const = 0;
+
+ protected:
+  // Processes the chunks of the input in parallel
+  std::shared_ptr<const Table> _on_execute() override;
+};
+
+}  // namespace opossum
@@ -0,0 +1,571 @@
+#include "aggregate.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/worker_pool.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+using GroupID = uint32_t;
+
+// Marks rows with a NULL group-by value, which do not belong to any group
+constexpr auto NULL_GROUP = std::numeric_limits<GroupID>::max();
+
+// Marks partial groups that are merged by the job of another partition
+constexpr auto OTHER_PARTITION = std::numeric_limits<size_t>::max();
+
+// Integers are summed up as longs, floating point numbers as doubles
+template <typename T>
+using SumType = std::conditional_t<std::is_integral_v<T>, int64_t, double>;
+
+// The dense chunk-local ids of the distinct values of a group-by column
+struct ColumnGroupIDs {
+  // the id of the value of each row, NULL_GROUP for NULLs
+  std::vector<GroupID> row_ids;
+  // the value of each id, as a std::vector of the column's type
+  AllTypeVector values;
+  size_t value_count = 0;
+};
+
+template <typename T>
+ColumnGroupIDs column_group_ids(const BaseSegment& segment) {
+  ColumnGroupIDs group_ids;
+  group_ids.row_ids.resize(segment.size(), NULL_GROUP);
+  std::vector<T> values;
+
+  // The ValueIDs of a dictionary are dense already, so no value has to be hashed. Only the values that occur in the
+  // chunk become groups, e.g., if the rows were selected by a scan before.
+  if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    const auto dictionary = dictionary_segment->decoded_dictionary();
+    std::vector<GroupID> ids_by_value_id(dictionary->size(), NULL_GROUP);
+    detail::resolve_attribute_vector(*dictionary_segment->attribute_vector(), [&](const auto& attribute_vector) {
+      detail::value_ids_iterate(attribute_vector, [&](const auto value_id, const ChunkOffset chunk_offset) {
+        auto& id = ids_by_value_id[static_cast<GroupID>(value_id)];
+        if (id == NULL_GROUP) {
+          id = static_cast<GroupID>(values.size());
+          values.push_back((*dictionary)[static_cast<GroupID>(value_id)]);
+        }
+        group_ids.row_ids[chunk_offset] = id;
+      });
+    });
+  } else {
+    std::unordered_map<T, GroupID> ids_by_value;
+    segment_iterate<T>(segment, [&](const T& value, const ChunkOffset chunk_offset) {
+      const auto insertion = ids_by_value.emplace(value, static_cast<GroupID>(values.size()));
+      if (insertion.second) values.push_back(value);
+      group_ids.row_ids[chunk_offset] = insertion.first->second;
+    });
+  }
+
+  group_ids.value_count = values.size();
+  group_ids.values = std::move(values);
+  return group_ids;
+}
+
+// Computes one aggregate for dense group ids. Each chunk is aggregated into its own accumulator, which is then merged
+// into the accumulator of the output.
+class BaseAccumulator {
+ public:
+  virtual ~BaseAccumulator() = default;
+
+  virtual void resize(const size_t group_count) = 0;
+
+  // aggregates the rows of a chunk, row_groups holds the chunk-local group of each row
+  virtual void aggregate(const Chunk& chunk, const std::vector<GroupID>& row_groups) = 0;
+
+  // merges the groups of a partial accumulator of the same type, group_mapping holds the group of each partial group
+  // partial groups mapped to OTHER_PARTITION are skipped, so that jobs of different partitions can merge concurrently
+  virtual void merge(const BaseAccumulator& partial, const std::vector<size_t>& group_mapping) = 0;
+
+  // returns the aggregated values of all groups
+  virtual std::shared_ptr<BaseSegment> output_segment() = 0;
+};
+
+// COUNT(*)
+class RowCountAccumulator : public BaseAccumulator {
+ public:
+  void resize(const size_t group_count) override { _counts.resize(group_count); }
+
+  void aggregate(const Chunk&, const std::vector<GroupID>& row_groups) override {
+    for (const auto group : row_groups) {
+      if (group != NULL_GROUP) ++_counts[group];
+    }
+  }
+
+  void merge(const BaseAccumulator& partial, const std::vector<size_t>& group_mapping) override {
+    const auto& partial_counts = static_cast<const RowCountAccumulator&>(partial)._counts;
+    for (auto group = size_t{0}; group < partial_counts.size(); ++group) {
+      if (group_mapping[group] != OTHER_PARTITION) _counts[group_mapping[group]] += partial_counts[group];
+    }
+  }
+
+  std::shared_ptr<BaseSegment> output_segment() override {
+    return std::make_shared<ValueSegment<int64_t>>(std::move(_counts));
+  }
+
+ protected:
+  std::vector<int64_t> _counts;
+};
+
+// The aggregates of a column. Only the state needed by the aggregate function is kept.
+template <typename T>
+class Accumulator : public BaseAccumulator {
+ public:
+  Accumulator(const ColumnID column_id, const AggregateFunction function)
+      : _column_id(column_id), _function(function) {}
+
+  void resize(const size_t group_count) override {
+    _counts.resize(group_count);
+    if (_function == AggregateFunction::Min || _function == AggregateFunction::Max) _values.resize(group_count);
+    if (_function == AggregateFunction::Sum || _function == AggregateFunction::Avg) _sums.resize(group_count);
+  }
+
+  void aggregate(const Chunk& chunk, const std::vector<GroupID>& row_groups) override {
+    segment_iterate<T>(*chunk.get_segment(_column_id), [&](const T& value, const ChunkOffset chunk_offset) {
+      const auto group = row_groups[chunk_offset];
+      if (group == NULL_GROUP) return;
+      if constexpr (std::is_arithmetic_v<T>) {
+        _add(group, 1, value, static_cast<SumType<T>>(value));
+      } else {
+        _add(group, 1, value, SumType<T>{});
+      }
+    });
+  }
+
+  void merge(const BaseAccumulator& partial_base, const std::vector<size_t>& group_mapping) override {
+    const auto& partial = static_cast<const Accumulator<T>&>(partial_base);
+    for (auto group = size_t{0}; group < partial._counts.size(); ++group) {
+      if (partial._counts[group] == 0 || group_mapping[group] == OTHER_PARTITION) continue;
+      const auto has_values = !partial._values.empty();
+      _add(group_mapping[group], partial._counts[group], has_values ? partial._values[group] : T{},
+           partial._sums.empty() ? SumType<T>{} : partial._sums[group]);
+    }
+  }
+
+  std::shared_ptr<BaseSegment> output_segment() override {
+    switch (_function) {
+      case AggregateFunction::Min:
+      case AggregateFunction::Max:
+        return std::make_shared<ValueSegment<T>>(std::move(_values));
+      case AggregateFunction::Sum:
+        if constexpr (std::is_arithmetic_v<T>) return std::make_shared<ValueSegment<SumType<T>>>(std::move(_sums));
+        break;
+      case AggregateFunction::Avg:
+        if constexpr (std::is_arithmetic_v<T>) {
+          std::vector<double> averages(_counts.size());
+          for (auto group = size_t{0}; group < _counts.size(); ++group) {
+            if (_counts[group] > 0) averages[group] = static_cast<double>(_sums[group]) / _counts[group];
+          }
+          return std::make_shared<ValueSegment<double>>(std::move(averages));
+        }
+        break;
+      case AggregateFunction::Count:
+        return std::make_shared<ValueSegment<int64_t>>(std::move(_counts));
+    }
+    Fail("SUM and AVG require numeric columns");
+    return nullptr;
+  }
+
+ protected:
+  // adds count values to a group, value is their minimum or maximum, sum their sum
+  void _add(const size_t group, const int64_t count, const T& value, const SumType<T>& sum) {
+    const auto is_first = _counts[group] == 0;
+    _counts[group] += count;
+    switch (_function) {
+      case AggregateFunction::Min:
+        if (is_first || value < _values[group]) _values[group] = value;
+        break;
+      case AggregateFunction::Max:
+        if (is_first || value > _values[group]) _values[group] = value;
+        break;
+      case AggregateFunction::Sum:
+      case AggregateFunction::Avg:
+        if constexpr (std::is_arithmetic_v<T>) _sums[group] += sum;
+        break;
+      case AggregateFunction::Count:
+        break;
+    }
+  }
+
+  const ColumnID _column_id;
+  const AggregateFunction _function;
+  std::vector<int64_t> _counts;
+  std::vector<T> _values;
+  std::vector<SumType<T>> _sums;
+};
+
+std::unique_ptr<BaseAccumulator> make_accumulator(const Table& input_table,
+                                                  const AggregateColumnDefinition& definition) {
+  if (!definition.column_id) return std::make_unique<RowCountAccumulator>();
+
+  std::unique_ptr<BaseAccumulator> accumulator;
+  resolve_data_type(input_table.column_type(*definition.column_id), [&](auto type) {
+    using Type = typename decltype(type)::type;
+    accumulator = std::make_unique<Accumulator<Type>>(*definition.column_id, definition.function);
+  });
+  return accumulator;
+}
+
+// The aggregates of the chunk-local groups of one chunk
+struct PartialResult {
+  size_t group_count = 0;
+  // The ids of the group-by values of each group, one id per group-by column and group after group. They are
+  // chunk-local at first and are then replaced by the ids of merge_column_values, which are shared by all chunks.
+  std::vector<GroupID> group_keys;
+  // the values of the chunk-local ids of each group-by column
+  std::vector<AllTypeVector> column_values;
+  std::vector<std::unique_ptr<BaseAccumulator>> accumulators;
+};
+
+// Assigns the rows of a chunk to dense chunk-local groups and stores the keys of the groups in the partial result.
+// The ids of the group-by columns are combined two at a time: the distinct pairs of ids are hashed and numbered, so
+// that the combined ids never exceed the chunk size.
+std::vector<GroupID> chunk_row_groups(const Table& input_table, const Chunk& chunk,
+                                      const std::vector<ColumnID>& groupby_column_ids, PartialResult& partial_result) {
+  if (groupby_column_ids.empty()) {
+    partial_result.group_count = 1;
+    return std::vector<GroupID>(chunk.size(), GroupID{0});
+  }
+
+  std::vector<GroupID> row_groups;
+  for (auto index = size_t{0}; index < groupby_column_ids.size(); ++index) {
+    const auto column_id = groupby_column_ids[index];
+    ColumnGroupIDs column_ids;
+    resolve_data_type(input_table.column_type(column_id), [&](auto type) {
+      using Type = typename decltype(type)::type;
+      column_ids = column_group_ids<Type>(*chunk.get_segment(column_id));
+    });
+    partial_result.column_values.push_back(std::move(column_ids.values));
+
+    if (index == 0) {
+      row_groups = std::move(column_ids.row_ids);
+      partial_result.group_count = column_ids.value_count;
+      partial_result.group_keys.resize(column_ids.value_count);
+      std::iota(partial_result.group_keys.begin(), partial_result.group_keys.end(), GroupID{0});
+      continue;
+    }
+
+    // The keys of the groups so far have index ids each, the combined keys get one more
+    std::unordered_map<uint64_t, GroupID> combined_ids;
+    std::vector<GroupID> combined_keys;
+    for (auto chunk_offset = size_t{0}; chunk_offset < row_groups.size(); ++chunk_offset) {
+      auto& group = row_groups[chunk_offset];
+      const auto column_id_of_row = column_ids.row_ids[chunk_offset];
+      if (group == NULL_GROUP || column_id_of_row == NULL_GROUP) {
+        group = NULL_GROUP;
+        continue;
+      }
+
+      const auto combined_key = (uint64_t{group} << 32) | column_id_of_row;
+      const auto insertion = combined_ids.emplace(combined_key, static_cast<GroupID>(combined_ids.size()));
+      if (insertion.second) {
+        const auto key = partial_result.group_keys.cbegin() + static_cast<std::ptrdiff_t>(group * index);
+        combined_keys.insert(combined_keys.end(), key, key + static_cast<std::ptrdiff_t>(index));
+        combined_keys.push_back(column_id_of_row);
+      }
+      group = insertion.first->second;
+    }
+    partial_result.group_count = combined_ids.size();
+    partial_result.group_keys = std::move(combined_keys);
+  }
+  return row_groups;
+}
+
+// Numbers the distinct values of a group-by column across all chunks in ascending order, so that the keys of the
+// groups can be compared by their ids, and replaces the chunk-local ids in the group keys of the partial results with
+// these ids. Returns the value of each id.
+template <typename T>
+std::vector<T> merge_column_values(std::vector<PartialResult>& partial_results, const size_t column_index,
+                                   const size_t key_width) {
+  std::unordered_map<T, GroupID> ids_by_value;
+  std::vector<T> values;
+  std::vector<std::vector<GroupID>> ids_by_chunk_id(partial_results.size());
+  for (auto chunk_id = size_t{0}; chunk_id < partial_results.size(); ++chunk_id) {
+    if (partial_results[chunk_id].group_count == 0) continue;
+    const auto& chunk_values = boost::get<std::vector<T>>(partial_results[chunk_id].column_values[column_index]);
+    auto& ids = ids_by_chunk_id[chunk_id];
+    ids.reserve(chunk_values.size());
+    for (const auto& value : chunk_values) {
+      const auto insertion = ids_by_value.emplace(value, static_cast<GroupID>(values.size()));
+      if (insertion.second) values.push_back(value);
+      ids.push_back(insertion.first->second);
+    }
+  }
+
+  std::vector<GroupID> order(values.size());
+  std::iota(order.begin(), order.end(), GroupID{0});
+  std::sort(order.begin(), order.end(),
+            [&](const auto left, const auto right) { return values[left] < values[right]; });
+  std::vector<GroupID> ranks(values.size());
+  std::vector<T> sorted_values;
+  sorted_values.reserve(values.size());
+  for (auto rank = size_t{0}; rank < order.size(); ++rank) {
+    ranks[order[rank]] = static_cast<GroupID>(rank);
+    sorted_values.push_back(std::move(values[order[rank]]));
+  }
+
+  for (auto chunk_id = size_t{0}; chunk_id < partial_results.size(); ++chunk_id) {
+    auto& partial_result = partial_results[chunk_id];
+    for (auto group = size_t{0}; group < partial_result.group_count; ++group) {
+      auto& id = partial_result.group_keys[group * key_width + column_index];
+      id = ranks[ids_by_chunk_id[chunk_id][id]];
+    }
+  }
+  return sorted_values;
+}
+
+// Hashes the key of a group. The multiplication with 2^64 / phi spreads the ids, which are small integers, over all
+// bits, so that the upper bits can select the partition.
+struct GroupKeyHash {
+  size_t operator()(const std::vector<GroupID>& key) const {
+    auto hash = uint64_t{0};
+    for (const auto id : key) hash = (hash ^ id) * uint64_t{0x9E3779B97F4A7C15};
+    return static_cast<size_t>(hash);
+  }
+};
+
+std::string aggregate_function_name(const AggregateFunction function) {
+  switch (function) {
+    case AggregateFunction::Min:
+      return "MIN";
+    case AggregateFunction::Max:
+      return "MAX";
+    case AggregateFunction::Sum:
+      return "SUM";
+    case AggregateFunction::Avg:
+      return "AVG";
+    case AggregateFunction::Count:
+      return "COUNT";
+  }
+  Fail("Unknown aggregate function");
+  return "";
+}
+
+}  // namespace
+
+Aggregate::Aggregate(const std::shared_ptr<const AbstractOperator> input,
+                     const std::vector<AggregateColumnDefinition>& aggregates,
+                     const std::vector<ColumnID>& groupby_column_ids)
+    : AbstractSinkOperator(input), _aggregates(aggregates), _groupby_column_ids(groupby_column_ids) {}
+
+const std::vector<AggregateColumnDefinition>& Aggregate::aggregates() const { return _aggregates; }
+
+const std::vector<ColumnID>& Aggregate::groupby_column_ids() const { return _groupby_column_ids; }
+
+const std::string Aggregate::name() const { return "Aggregate"; }
+
+std::string Aggregate::description() const {
+  std::stringstream stream;
+  stream << name() << " (";
+  for (auto index = size_t{0}; index < _aggregates.size(); ++index) {
+    const auto& definition = _aggregates[index];
+    stream << (index > 0 ? ", " : "") << aggregate_function_name(definition.function) << "(";
+    if (definition.column_id) {
+      stream << "#" << *definition.column_id;
+    } else {
+      stream << "*";
+    }
+    stream << ")";
+  }
+  for (auto index = size_t{0}; index < _groupby_column_ids.size(); ++index) {
+    stream << (index > 0 ? ", #" : " GROUP BY #") << _groupby_column_ids[index];
+  }
+  stream << ")";
+  return stream.str();
+}
+
+std::shared_ptr<const Table> Aggregate::consume(const std::shared_ptr<const Table>& input_table,
+                                                const ChunkID morsel_count, const MorselProducer& producer) const {
+  auto output_table = std::make_shared<Table>();
+  for (const auto& column_id : _groupby_column_ids) {
+    Assert(column_id < input_table->column_count(), "Aggregate: Unknown group-by column");
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+  for (const auto& definition : _aggregates) {
+    const auto function_name = aggregate_function_name(definition.function);
+    if (!definition.column_id) {
+      Assert(definition.function == AggregateFunction::Count, "Aggregate: Only COUNT can be used without a column");
+      output_table->add_column_definition(function_name + "(*)", "long");
+      continue;
+    }
+
+    const auto column_id = *definition.column_id;
+    Assert(column_id < input_table->column_count(), "Aggregate: Unknown aggregate column");
+    const auto& column_type = input_table->column_type(column_id);
+    auto output_type = column_type;
+    if (definition.function == AggregateFunction::Count) output_type = "long";
+    if (definition.function == AggregateFunction::Avg) output_type = "double";
+    if (definition.function == AggregateFunction::Sum) {
+      output_type = (column_type == "int" || column_type == "long") ? "long" : "double";
+    }
+    if (definition.function == AggregateFunction::Sum || definition.function == AggregateFunction::Avg) {
+      Assert(column_type != "string", "Aggregate: SUM and AVG require numeric columns");
+    }
+    output_table->add_column_definition(function_name + "(" + input_table->column_name(column_id) + ")", output_type);
+  }
+
+  // Aggregate each chunk into its own partial result
+  std::vector<PartialResult> partial_results(morsel_count);
+  std::vector<std::function<void()>> jobs;
+  for (auto chunk_id = ChunkID{0}; chunk_id < morsel_count; ++chunk_id) {
+    jobs.emplace_back([&, chunk_id]() {
+      const auto morsel = producer(chunk_id);
+      const auto& chunk = morsel.chunk;
+      if (chunk.size() == 0) return;
+
+      auto& partial_result = partial_results[chunk_id];
+      const auto row_groups = chunk_row_groups(*input_table, chunk, _groupby_column_ids, partial_result);
+      for (const auto& definition : _aggregates) {
+        auto accumulator = make_accumulator(*input_table, definition);
+        accumulator->resize(partial_result.group_count);
+        accumulator->aggregate(chunk, row_groups);
+        partial_result.accumulators.push_back(std::move(accumulator));
+      }
+    });
+  }
+  WorkerPool::get().run_and_wait(jobs);
+
+  // Give the values of each group-by column ids that are shared by all chunks, one job per column
+  const auto key_width = _groupby_column_ids.size();
+  std::vector<AllTypeVector> output_column_values(key_width);
+  jobs.clear();
+  for (auto index = size_t{0}; index < key_width; ++index) {
+    jobs.emplace_back([&, index]() {
+      resolve_data_type(input_table->column_type(_groupby_column_ids[index]), [&](auto type) {
+        using Type = typename decltype(type)::type;
+        output_column_values[index] = merge_column_values<Type>(partial_results, index, key_width);
+      });
+    });
+  }
+  WorkerPool::get().run_and_wait(jobs);
+
+  // The groups are partitioned by the hash of their keys, so that each partition can be merged by its own job
+  const auto partition_count = std::max(WorkerPool::get().worker_count(), size_t{1});
+  const auto group_key = [&](const PartialResult& partial_result, const size_t group) {
+    const auto key_begin = partial_result.group_keys.cbegin() + static_cast<std::ptrdiff_t>(group * key_width);
+    return std::vector<GroupID>(key_begin, key_begin + static_cast<std::ptrdiff_t>(key_width));
+  };
+  std::vector<std::vector<size_t>> group_partitions(morsel_count);
+  // the output group of each partial group, first numbered within its partition and later in the output order
+  std::vector<std::vector<size_t>> group_mappings(morsel_count);
+  jobs.clear();
+  for (auto chunk_id = ChunkID{0}; chunk_id < morsel_count; ++chunk_id) {
+    jobs.emplace_back([&, chunk_id]() {
+      const auto& partial_result = partial_results[chunk_id];
+      group_mappings[chunk_id].resize(partial_result.group_count);
+      group_partitions[chunk_id].resize(partial_result.group_count);
+      for (auto group = size_t{0}; group < partial_result.group_count; ++group) {
+        group_partitions[chunk_id][group] = (GroupKeyHash{}(group_key(partial_result, group)) >> 32) % partition_count;
+      }
+    });
+  }
+  WorkerPool::get().run_and_wait(jobs);
+
+  // Number the distinct groups of each partition. Each job only writes the mappings of the groups of its partition.
+  std::vector<std::vector<std::vector<GroupID>>> partition_keys(partition_count);
+  jobs.clear();
+  for (auto partition = size_t{0}; partition < partition_count; ++partition) {
+    jobs.emplace_back([&, partition]() {
+      std::unordered_map<std::vector<GroupID>, size_t, GroupKeyHash> groups_by_key;
+      auto& keys = partition_keys[partition];
+      for (auto chunk_id = ChunkID{0}; chunk_id < morsel_count; ++chunk_id) {
+        const auto& partial_result = partial_results[chunk_id];
+        for (auto group = size_t{0}; group < partial_result.group_count; ++group) {
+          if (group_partitions[chunk_id][group] != partition) continue;
+          const auto insertion = groups_by_key.emplace(group_key(partial_result, group), keys.size());
+          if (insertion.second) keys.push_back(insertion.first->first);
+          group_mappings[chunk_id][group] = insertion.first->second;
+        }
+      }
+    });
+  }
+  WorkerPool::get().run_and_wait(jobs);
+
+  // Without group-by columns, all rows form a single group, even if there are none (e.g., COUNT(*) of an empty table)
+  if (_groupby_column_ids.empty() && std::all_of(partition_keys.cbegin(), partition_keys.cend(),
+                                                 [](const auto& keys) { return keys.empty(); })) {
+    partition_keys[0].emplace_back();
+  }
+
+  // Sort the groups of all partitions by their keys. The ids of the values follow the order of the values.
+  std::vector<size_t> partition_offsets(partition_count + 1);
+  std::vector<const std::vector<GroupID>*> output_keys;
+  for (auto partition = size_t{0}; partition < partition_count; ++partition) {
+    partition_offsets[partition + 1] = partition_offsets[partition] + partition_keys[partition].size();
+    for (const auto& key : partition_keys[partition]) output_keys.push_back(&key);
+  }
+  const auto output_group_count = output_keys.size();
+  std::vector<size_t> output_order(output_group_count);
+  std::iota(output_order.begin(), output_order.end(), size_t{0});
+  std::sort(output_order.begin(), output_order.end(),
+            [&](const auto left, const auto right) { return *output_keys[left] < *output_keys[right]; });
+  std::vector<size_t> output_groups(output_group_count);
+  for (auto rank = size_t{0}; rank < output_group_count; ++rank) output_groups[output_order[rank]] = rank;
+
+  std::vector<std::unique_ptr<BaseAccumulator>> output_accumulators;
+  for (const auto& definition : _aggregates) {
+    output_accumulators.push_back(make_accumulator(*input_table, definition));
+    output_accumulators.back()->resize(output_group_count);
+  }
+
+  // Merge the partial results per partition. The partitions hold disjoint groups, so the jobs write disjoint entries of
+  // the output accumulators.
+  jobs.clear();
+  for (auto partition = size_t{0}; partition < partition_count; ++partition) {
+    jobs.emplace_back([&, partition]() {
+      for (auto chunk_id = ChunkID{0}; chunk_id < morsel_count; ++chunk_id) {
+        const auto& partial_result = partial_results[chunk_id];
+        // Empty chunks were skipped
+        if (partial_result.accumulators.empty()) continue;
+
+        std::vector<size_t> group_mapping(partial_result.group_count, OTHER_PARTITION);
+        for (auto group = size_t{0}; group < partial_result.group_count; ++group) {
+          if (group_partitions[chunk_id][group] != partition) continue;
+          group_mapping[group] = output_groups[partition_offsets[partition] + group_mappings[chunk_id][group]];
+        }
+        for (auto index = size_t{0}; index < _aggregates.size(); ++index) {
+          output_accumulators[index]->merge(*partial_result.accumulators[index], group_mapping);
+        }
+      }
+    });
+  }
+  WorkerPool::get().run_and_wait(jobs);
+
+  Chunk output_chunk;
+  for (auto index = size_t{0}; index < key_width; ++index) {
+    boost::apply_visitor(
+        [&](const auto& values) {
+          using Type = typename std::decay_t<decltype(values)>::value_type;
+          std::vector<Type> output_values(output_group_count);
+          for (auto rank = size_t{0}; rank < output_group_count; ++rank) {
+            output_values[rank] = values[(*output_keys[output_order[rank]])[index]];
+          }
+          output_chunk.add_segment(std::make_shared<ValueSegment<Type>>(std::move(output_values)));
+        },
+        output_column_values[index]);
+  }
+  for (auto& output_accumulator : output_accumulators) output_chunk.add_segment(output_accumulator->output_segment());
+  output_table->emplace_chunk(std::move(output_chunk));
+
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <optional>
+#include <vector>
+
+#include "abstract_sink_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// An aggregate function and the column it is applied to. COUNT(*) has no column.
+struct AggregateColumnDefinition {
+  std::optional<ColumnID> column_id;
+  AggregateFunction function;
+};
+
+// Groups the rows of the input by the values of the group-by columns and computes the aggregates for each group. The
+// output holds the group-by columns followed by one column per aggregate, which is named like "SUM(b)" or "COUNT(*)".
+// Its rows are sorted by the group-by values. Without group-by columns, all rows form a single group.
+//
+// Each chunk is aggregated into a partial result by its own job on the WorkerPool. In a Pipeline, that job first
+// produces the chunk from a chunk of the pipeline's source. The rows of a chunk are assigned to
+// dense chunk-local group ids, which index plain arrays of aggregate values. If a group-by column is stored in a
+// DictionarySegment, its ValueIDs are mapped to the group ids directly. Other segments are hashed. Once all chunks are
+// done, the distinct values of each group-by column are numbered across all chunks in their sort order, so that a
+// group is identified by a tuple of integer ids. The groups are then partitioned by the hash of these tuples and each
+// partition is merged by its own job.
+//
+// Like in SQL, the aggregates ignore NULL values (which only ReferenceSegments can hold). The output consists of
+// ValueSegments, which cannot hold NULLs. Therefore, rows with a NULL group-by value are skipped, and the aggregates of
+// a group without any non-NULL value are 0. An empty input produces an empty output if there are group-by columns, and
+// a single row (e.g., a COUNT(*) of 0) otherwise.
+class Aggregate : public AbstractSinkOperator {
+ public:
+  Aggregate(const std::shared_ptr<const AbstractOperator> input,
+            const std::vector<AggregateColumnDefinition>& aggregates, const std::vector<ColumnID>& groupby_column_ids);
+
+  const std::vector<AggregateColumnDefinition>& aggregates() const;
+  const std::vector<ColumnID>& groupby_column_ids() const;
+
+  const std::string name() const override;
+  std::string description() const override;
+
+  std::shared_ptr<const Table> consume(const std::shared_ptr<const Table>& input_table, const ChunkID morsel_count,
+                                       const MorselProducer& producer) const override;
+
+ protected:
+  const std::vector<AggregateColumnDefinition> _aggregates;
+  const std::vector<ColumnID> _groupby_column_ids;
+};
+
+}  // namespace opossum
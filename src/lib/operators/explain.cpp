@@ -0,0 +1,201 @@
+#include "explain.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "pipeline.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Returns the operators that a Pipeline executes chunk by chunk instead of executing them itself
+std::vector<std::shared_ptr<const AbstractOperator>> fused_operators(const AbstractOperator& op) {
+  std::vector<std::shared_ptr<const AbstractOperator>> operators;
+  const auto pipeline = dynamic_cast<const Pipeline*>(&op);
+  if (!pipeline) return operators;
+  for (const auto& streaming_operator : pipeline->streaming_operators()) operators.push_back(streaming_operator);
+  if (pipeline->sink()) operators.push_back(pipeline->sink());
+  return operators;
+}
+
+// Assigns ids to the operators in the order in which a depth-first walk from the root reaches them first. The
+// operators fused into a Pipeline are not inputs of it, but get the ids right after it. fused_into holds the id of the
+// pipeline of each fused operator.
+void collect_operators(const std::shared_ptr<const AbstractOperator>& op,
+                       std::unordered_map<const AbstractOperator*, size_t>& ids,
+                       std::vector<std::shared_ptr<const AbstractOperator>>& operators,
+                       std::vector<std::optional<size_t>>& fused_into) {
+  if (!op || !ids.emplace(op.get(), operators.size()).second) return;
+  const auto id = operators.size();
+  operators.push_back(op);
+  fused_into.emplace_back();
+  for (const auto& fused_operator : fused_operators(*op)) {
+    if (!ids.emplace(fused_operator.get(), operators.size()).second) continue;
+    operators.push_back(fused_operator);
+    fused_into.emplace_back(id);
+  }
+  collect_operators(op->input_left(), ids, operators, fused_into);
+  collect_operators(op->input_right(), ids, operators, fused_into);
+}
+
+double milliseconds(const std::chrono::nanoseconds duration) {
+  return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+// Escapes a string for a JSON string or a Graphviz label. Both understand the escape sequences of C.
+std::string escaped(const std::string& string) {
+  std::stringstream result;
+  for (const auto character : string) {
+    if (character == '"' || character == '\\') {
+      result << '\\' << character;
+    } else if (character == '\n') {
+      result << "\\n";
+    } else if (character == '\t') {
+      result << "\\t";
+    } else if (static_cast<unsigned char>(character) < 0x20) {
+      result << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(character) << std::dec;
+    } else {
+      result << character;
+    }
+  }
+  return result.str();
+}
+
+void print_performance_data(const OperatorPerformanceData& data, std::ostream& out) {
+  if (!data.executed) {
+    out << "not executed";
+    return;
+  }
+  // The caller's formatting of numbers is restored afterwards
+  const auto flags = out.flags();
+  const auto precision = out.precision();
+  out << std::fixed << std::setprecision(3) << milliseconds(data.walltime) << " ms, cpu "
+      << milliseconds(data.cpu_time) << " ms, rows " << data.input_row_count_left;
+  out.flags(flags);
+  out.precision(precision);
+  if (data.input_row_count_right) out << "/" << data.input_row_count_right;
+  out << " -> " << data.output_row_count << ", " << data.output_chunk_count << " chunks, " << data.output_bytes
+      << " bytes";
+}
+
+void explain_text(const std::shared_ptr<const AbstractOperator>& op,
+                  const std::unordered_map<const AbstractOperator*, size_t>& ids,
+                  const std::vector<std::optional<size_t>>& fused_into, std::vector<bool>& printed, const size_t depth,
+                  std::ostream& out) {
+  const auto id = ids.at(op.get());
+  out << std::string(depth * 2, ' ') << "[" << id << "] ";
+  if (printed[id]) {
+    out << op->name() << " (see above)" << std::endl;
+    return;
+  }
+  printed[id] = true;
+
+  out << op->description() << " | ";
+  print_performance_data(op->performance_data(), out);
+  out << std::endl;
+
+  // The fused operators of a pipeline are listed before its input, they have no performance data of their own
+  for (const auto& fused_operator : fused_operators(*op)) {
+    const auto fused_id = ids.at(fused_operator.get());
+    if (fused_into[fused_id] != id) continue;
+    printed[fused_id] = true;
+    out << std::string((depth + 1) * 2, ' ') << "[" << fused_id << "] " << fused_operator->description()
+        << " | fused into [" << id << "]" << std::endl;
+  }
+
+  for (const auto& input : {op->input_left(), op->input_right()}) {
+    if (input) explain_text(input, ids, fused_into, printed, depth + 1, out);
+  }
+}
+
+void explain_json(const std::vector<std::shared_ptr<const AbstractOperator>>& operators,
+                  const std::unordered_map<const AbstractOperator*, size_t>& ids,
+                  const std::vector<std::optional<size_t>>& fused_into, std::ostream& out) {
+  out << "{\"operators\": [";
+  for (auto id = size_t{0}; id < operators.size(); ++id) {
+    const auto& op = operators[id];
+    const auto& data = op->performance_data();
+    out << (id > 0 ? ",\n  " : "\n  ") << "{\"id\": " << id << ", \"name\": \"" << escaped(op->name())
+        << "\", \"description\": \"" << escaped(op->description()) << "\", \"inputs\": [";
+    auto separator = "";
+    for (const auto& input : {op->input_left(), op->input_right()}) {
+      if (!input) continue;
+      out << separator << ids.at(input.get());
+      separator = ", ";
+    }
+    out << "], \"executed\": " << (data.executed ? "true" : "false") << ", \"walltime_ns\": " << data.walltime.count()
+        << ", \"cpu_time_ns\": " << data.cpu_time.count() << ", \"input_row_count_left\": "
+        << data.input_row_count_left << ", \"input_row_count_right\": " << data.input_row_count_right
+        << ", \"output_row_count\": " << data.output_row_count
+        << ", \"output_chunk_count\": " << data.output_chunk_count
+        << ", \"output_bytes\": " << data.output_bytes << ", \"fused_into\": ";
+    if (fused_into[id]) {
+      out << *fused_into[id];
+    } else {
+      out << "null";
+    }
+    out << "}";
+  }
+  out << "\n]}" << std::endl;
+}
+
+void explain_graphviz(const std::vector<std::shared_ptr<const AbstractOperator>>& operators,
+                      const std::unordered_map<const AbstractOperator*, size_t>& ids,
+                      const std::vector<std::optional<size_t>>& fused_into, std::ostream& out) {
+  out << "digraph {" << std::endl;
+  out << "  node [shape=box];" << std::endl;
+  for (auto id = size_t{0}; id < operators.size(); ++id) {
+    const auto& op = operators[id];
+    std::stringstream performance_data;
+    if (fused_into[id]) {
+      performance_data << "fused into op" << *fused_into[id];
+    } else {
+      print_performance_data(op->performance_data(), performance_data);
+    }
+    out << "  op" << id << " [label=\"" << escaped(op->description() + "\n" + performance_data.str()) << "\"";
+    if (fused_into[id]) out << ", style=dashed";
+    out << "];" << std::endl;
+  }
+  for (auto id = size_t{0}; id < operators.size(); ++id) {
+    for (const auto& input : {operators[id]->input_left(), operators[id]->input_right()}) {
+      if (input) out << "  op" << ids.at(input.get()) << " -> op" << id << ";" << std::endl;
+    }
+  }
+  out << "}" << std::endl;
+}
+
+}  // namespace
+
+void explain(const std::shared_ptr<const AbstractOperator>& root, std::ostream& out, const ExplainFormat format) {
+  Assert(root, "explain: No operator given");
+
+  std::unordered_map<const AbstractOperator*, size_t> ids;
+  std::vector<std::shared_ptr<const AbstractOperator>> operators;
+  std::vector<std::optional<size_t>> fused_into;
+  collect_operators(root, ids, operators, fused_into);
+
+  switch (format) {
+    case ExplainFormat::Text: {
+      std::vector<bool> printed(operators.size());
+      explain_text(root, ids, fused_into, printed, 0, out);
+      break;
+    }
+    case ExplainFormat::Json:
+      explain_json(operators, ids, fused_into, out);
+      break;
+    case ExplainFormat::Graphviz:
+      explain_graphviz(operators, ids, fused_into, out);
+      break;
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+
+namespace opossum {
+
+class AbstractOperator;
+
+enum class ExplainFormat { Text, Json, Graphviz };
+
+// Prints the operator DAG below root, reached via input_left() and input_right(), together with the performance data
+// of each operator. Operators that are the input of several operators are printed once and get an id by which the
+// other consumers refer to them. Text prints an indented tree, Json an array of operators with the ids of their
+// inputs, and Graphviz a digraph in the dot language whose edges point from the inputs to their consumers. The
+// operators fused into a Pipeline are listed right after it and are marked as fused, as they are not executed on their
+// own and have no performance data.
+void explain(const std::shared_ptr<const AbstractOperator>& root, std::ostream& out = std::cout,
+             const ExplainFormat format = ExplainFormat::Text);
+
+}  // namespace opossum
@@ -0,0 +1,315 @@
+#include "join_hash.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "output_segments.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/worker_pool.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// The hash table of a build partition should fit into the L2 cache. More partitions than 2^MAX_RADIX_BITS would make
+// the scattering itself miss the TLB and the cache.
+constexpr auto TARGET_PARTITION_BYTES = size_t{256 * 1024};
+constexpr auto MAX_RADIX_BITS = size_t{10};
+
+// Marks the end of a chain of build rows with the same value
+constexpr auto NO_NEXT = std::numeric_limits<size_t>::max();
+
+template <typename T>
+struct Element {
+  T value;
+  RowID row_id;
+};
+
+// The materialized join column of one input. Partition p consists of elements[offsets[p]] to elements[offsets[p + 1]].
+template <typename T>
+struct Partitions {
+  std::vector<Element<T>> elements;
+  std::vector<size_t> offsets;
+  // Rows whose join key is NULL. They are only collected for the probe side of left outer and anti joins.
+  std::vector<RowID> null_rows;
+};
+
+// The matching rows of one partition. For semi and anti joins, right stays empty.
+struct JoinResult {
+  std::vector<RowID> left;
+  std::vector<RowID> right;
+};
+
+template <typename T>
+size_t radix_partition(const T& value, const size_t radix_bits) {
+  if (radix_bits == 0) return 0;
+  // std::hash is the identity for integers. Multiplying with 2^64 / phi moves entropy from the lower bits to the upper
+  // bits, which select the partition.
+  const auto hash = static_cast<uint64_t>(std::hash<T>{}(value)) * uint64_t{0x9E3779B97F4A7C15};
+  return static_cast<size_t>(hash >> (64 - radix_bits));
+}
+
+// Chooses the number of radix bits so that each worker gets a partition and each build partition fits into the cache
+template <typename T>
+size_t radix_bit_count(const Table& build_table) {
+  // An element, its entry in the chain of equal values, and (at most) one node of the hash table
+  constexpr auto bytes_per_row = sizeof(Element<T>) + sizeof(size_t) + sizeof(std::pair<T, size_t>) + 2 * sizeof(void*);
+  const auto build_bytes = build_table.row_count() * bytes_per_row;
+
+  auto radix_bits = size_t{0};
+  while (radix_bits < MAX_RADIX_BITS && ((size_t{1} << radix_bits) < WorkerPool::get().worker_count() ||
+                                         (size_t{1} << radix_bits) * TARGET_PARTITION_BYTES < build_bytes)) {
+    ++radix_bits;
+  }
+  return radix_bits;
+}
+
+// Materializes the join column of the table and scatters it into 2^radix_bits partitions. Each chunk is first
+// materialized and counted per partition. The per-chunk histograms then determine where each chunk writes its elements
+// to, so that the scatter runs in parallel without synchronization and keeps the order of the rows.
+template <typename T>
+Partitions<T> partition_table(const Table& table, const ColumnID column_id, const size_t radix_bits,
+                              const bool collect_null_rows) {
+  const auto chunk_count = table.chunk_count();
+  const auto partition_count = size_t{1} << radix_bits;
+
+  std::vector<std::vector<Element<T>>> chunk_elements(chunk_count);
+  std::vector<std::vector<size_t>> histograms(chunk_count, std::vector<size_t>(partition_count));
+  std::vector<std::vector<RowID>> chunk_null_rows(chunk_count);
+
+  std::vector<std::function<void()>> jobs;
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back([&, chunk_id]() {
+      const auto chunk = table.get_chunk(chunk_id);
+      if (chunk->size() == 0) return;
+      const auto segment = chunk->get_segment(column_id);
+
+      auto& elements = chunk_elements[chunk_id];
+      auto& histogram = histograms[chunk_id];
+      elements.reserve(chunk->size());
+
+      // Only ReferenceSegments can hold NULLs, which segment_iterate skips
+      const auto track_nulls = collect_null_rows && std::dynamic_pointer_cast<const ReferenceSegment>(segment);
+      std::vector<bool> visited(track_nulls ? chunk->size() : 0);
+
+      segment_iterate<T>(*segment, [&](const T& value, const ChunkOffset chunk_offset) {
+        elements.push_back(Element<T>{value, RowID{chunk_id, chunk_offset}});
+        ++histogram[radix_partition(value, radix_bits)];
+        if (track_nulls) visited[chunk_offset] = true;
+      });
+
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < visited.size(); ++chunk_offset) {
+        if (!visited[chunk_offset]) chunk_null_rows[chunk_id].push_back(RowID{chunk_id, chunk_offset});
+      }
+    });
+  }
+  WorkerPool::get().run_and_wait(jobs);
+
+  Partitions<T> partitions;
+  partitions.offsets.resize(partition_count + 1);
+
+  // Turn the histograms into the write positions of each chunk within each partition
+  auto write_position = size_t{0};
+  for (auto partition = size_t{0}; partition < partition_count; ++partition) {
+    partitions.offsets[partition] = write_position;
+    for (auto& histogram : histograms) {
+      const auto count = histogram[partition];
+      histogram[partition] = write_position;
+      write_position += count;
+    }
+  }
+  partitions.offsets[partition_count] = write_position;
+  partitions.elements.resize(write_position);
+
+  jobs.clear();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back([&, chunk_id]() {
+      auto& write_positions = histograms[chunk_id];
+      for (auto& element : chunk_elements[chunk_id]) {
+        const auto partition = radix_partition(element.value, radix_bits);
+        partitions.elements[write_positions[partition]++] = std::move(element);
+      }
+      // The materialized chunk is not needed anymore
+      chunk_elements[chunk_id] = {};
+    });
+  }
+  WorkerPool::get().run_and_wait(jobs);
+
+  for (const auto& null_rows : chunk_null_rows) {
+    partitions.null_rows.insert(partitions.null_rows.end(), null_rows.begin(), null_rows.end());
+  }
+
+  return partitions;
+}
+
+// Builds a hash table for one partition of the right input and probes it with the same partition of the left input
+template <typename T>
+JoinResult join_partition(const Partitions<T>& left, const Partitions<T>& right, const size_t partition,
+                          const JoinMode mode) {
+  const auto build_begin = right.offsets[partition];
+  const auto build_size = right.offsets[partition + 1] - build_begin;
+
+  // The hash table maps each value to the first build row with that value. Further rows are chained through next.
+  // Inserting the rows back to front keeps the chains in the order of the build input.
+  std::unordered_map<T, size_t> heads;
+  heads.reserve(build_size);
+  std::vector<size_t> next(build_size, NO_NEXT);
+  for (auto index = build_size; index-- > 0;) {
+    const auto insertion = heads.emplace(right.elements[build_begin + index].value, index);
+    if (!insertion.second) {
+      next[index] = insertion.first->second;
+      insertion.first->second = index;
+    }
+  }
+
+  JoinResult result;
+  for (auto probe_index = left.offsets[partition]; probe_index < left.offsets[partition + 1]; ++probe_index) {
+    const auto& element = left.elements[probe_index];
+    const auto match = heads.find(element.value);
+
+    switch (mode) {
+      case JoinMode::Inner:
+      case JoinMode::Left:
+        if (match == heads.end()) {
+          if (mode == JoinMode::Left) {
+            result.left.push_back(element.row_id);
+            result.right.push_back(NULL_ROW_ID);
+          }
+          break;
+        }
+        for (auto index = match->second; index != NO_NEXT; index = next[index]) {
+          result.left.push_back(element.row_id);
+          result.right.push_back(right.elements[build_begin + index].row_id);
+        }
+        break;
+      case JoinMode::Semi:
+        if (match != heads.end()) result.left.push_back(element.row_id);
+        break;
+      case JoinMode::Anti:
+        if (match == heads.end()) result.left.push_back(element.row_id);
+        break;
+    }
+  }
+
+  return result;
+}
+
+template <typename T>
+std::vector<JoinResult> join(const Table& left_table, const Table& right_table,
+                             const std::pair<ColumnID, ColumnID>& column_ids, const JoinMode mode) {
+  const auto radix_bits = radix_bit_count<T>(right_table);
+  const auto partition_count = size_t{1} << radix_bits;
+
+  const auto collect_null_rows = mode == JoinMode::Left || mode == JoinMode::Anti;
+  const auto left = partition_table<T>(left_table, column_ids.first, radix_bits, collect_null_rows);
+  const auto right = partition_table<T>(right_table, column_ids.second, radix_bits, false);
+
+  std::vector<JoinResult> results(partition_count);
+  std::vector<std::function<void()>> jobs;
+  for (auto partition = size_t{0}; partition < partition_count; ++partition) {
+    jobs.emplace_back([&, partition]() { results[partition] = join_partition(left, right, partition, mode); });
+  }
+  WorkerPool::get().run_and_wait(jobs);
+
+  // Left rows with a NULL key have no join partner
+  if (!left.null_rows.empty()) {
+    JoinResult null_result;
+    null_result.left = left.null_rows;
+    if (mode == JoinMode::Left) null_result.right.resize(left.null_rows.size(), NULL_ROW_ID);
+    results.push_back(std::move(null_result));
+  }
+
+  return results;
+}
+
+}  // namespace
+
+JoinHash::JoinHash(const std::shared_ptr<const AbstractOperator> left,
+                   const std::shared_ptr<const AbstractOperator> right, const JoinMode mode,
+                   const std::pair<ColumnID, ColumnID>& column_ids)
+    : AbstractOperator(left, right), _mode(mode), _column_ids(column_ids) {}
+
+JoinMode JoinHash::mode() const { return _mode; }
+
+const std::pair<ColumnID, ColumnID>& JoinHash::column_ids() const { return _column_ids; }
+
+const std::string JoinHash::name() const { return "JoinHash"; }
+
+std::string JoinHash::description() const {
+  std::stringstream stream;
+  stream << name() << " (";
+  switch (_mode) {
+    case JoinMode::Inner:
+      stream << "Inner";
+      break;
+    case JoinMode::Left:
+      stream << "Left";
+      break;
+    case JoinMode::Semi:
+      stream << "Semi";
+      break;
+    case JoinMode::Anti:
+      stream << "Anti";
+      break;
+  }
+  stream << ", #" << _column_ids.first << " = #" << _column_ids.second << ")";
+  return stream.str();
+}
+
+std::shared_ptr<const Table> JoinHash::_on_execute() {
+  const auto left_table = _input_table_left();
+  const auto right_table = _input_table_right();
+  const auto& column_type = left_table->column_type(_column_ids.first);
+  Assert(column_type == right_table->column_type(_column_ids.second), "JoinHash requires join columns of equal type");
+
+  std::vector<JoinResult> results;
+  resolve_data_type(column_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    results = join<Type>(*left_table, *right_table, _column_ids, _mode);
+  });
+
+  const auto emits_right_columns = _mode == JoinMode::Inner || _mode == JoinMode::Left;
+
+  auto output_table = std::make_shared<Table>();
+  for (auto column_id = ColumnID{0}; column_id < left_table->column_count(); ++column_id) {
+    output_table->add_column_definition(left_table->column_name(column_id), left_table->column_type(column_id));
+  }
+  if (emits_right_columns) {
+    for (auto column_id = ColumnID{0}; column_id < right_table->column_count(); ++column_id) {
+      output_table->add_column_definition(right_table->column_name(column_id), right_table->column_type(column_id));
+    }
+  }
+
+  const auto create_output_chunk = [&](JoinResult&& result) {
+    Chunk output_chunk;
+    add_output_segments(output_chunk, left_table, std::make_shared<const PosList>(std::move(result.left)));
+    if (emits_right_columns) {
+      add_output_segments(output_chunk, right_table, std::make_shared<const PosList>(std::move(result.right)));
+    }
+    return output_chunk;
+  };
+
+  for (auto& result : results) {
+    if (result.left.empty()) continue;
+    output_table->emplace_chunk(create_output_chunk(std::move(result)));
+  }
+
+  // Even if no row matches, the output has to contain (empty) segments for all columns
+  if (output_table->row_count() == 0) output_table->emplace_chunk(create_output_chunk(JoinResult{}));
+
+  return output_table;
+}
+
+}  // namespace opossum
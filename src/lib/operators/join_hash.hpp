@@ -0,0 +1,42 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// Equi-join of two tables on one column each. The right input is the build side, the left input is the probe side.
+//
+// Both inputs are radix-partitioned on the hash of the join key so that the hash table of each partition fits into the
+// L2 cache. Materializing, partitioning, as well as building and probing the partitions run in parallel on the
+// WorkerPool.
+//
+// The output consists of ReferenceSegments. For inner and left outer joins, it holds the columns of the left input
+// followed by those of the right input. Rows of a left outer join without a join partner reference NULL_ROW_ID in the
+// right columns. Semi and anti joins only output the columns of the left input. Like in SQL, NULL keys (which only
+// ReferenceSegments can hold) never find a join partner.
+class JoinHash : public AbstractOperator {
+ public:
+  JoinHash(const std::shared_ptr<const AbstractOperator> left, const std::shared_ptr<const AbstractOperator> right,
+           const JoinMode mode, const std::pair<ColumnID, ColumnID>& column_ids);
+
+  JoinMode mode() const;
+  const std::pair<ColumnID, ColumnID>& column_ids() const;
+
+  const std::string name() const override;
+  std::string description() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const JoinMode _mode;
+  const std::pair<ColumnID, ColumnID> _column_ids;
+};
+
+}  // namespace opossum
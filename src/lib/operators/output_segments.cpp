@@ -0,0 +1,101 @@
+#include "output_segments.hpp"
+
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "storage/chunk.hpp"
+#include "storage/pos_list.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Returns the positions of input_pos_list at the offsets stored in filter. If the input references a single chunk, so
+// does the result, which then stays a range as long as the selected offsets are contiguous.
+std::shared_ptr<const PosList> select_positions(const PosList& input_pos_list, const PosList& filter) {
+  auto pos_list = input_pos_list.references_single_chunk()
+                      ? std::make_shared<PosList>(input_pos_list.common_chunk_id())
+                      : std::make_shared<PosList>();
+  pos_list->reserve(filter.size());
+  filter.for_each_chunk([&](const ChunkID, const size_t begin_index, const size_t end_index,
+                            const auto& chunk_offset_at) {
+    for (auto index = begin_index; index < end_index; ++index) {
+      pos_list->push_back(input_pos_list[chunk_offset_at(index)]);
+    }
+  });
+  return pos_list;
+}
+
+}  // namespace
+
+void add_output_segments(Chunk& output_chunk, const std::shared_ptr<const Table>& input_table,
+                         const std::shared_ptr<const PosList>& pos_list) {
+  std::map<std::vector<const PosList*>, std::shared_ptr<const PosList>> resolved_pos_lists;
+
+  for (auto column_id = ColumnID{0}; column_id < input_table->column_count(); ++column_id) {
+    const auto first_chunk = input_table->get_chunk(ChunkID{0});
+    const auto is_reference_column =
+        column_id < first_chunk->column_count() &&
+        std::dynamic_pointer_cast<const ReferenceSegment>(first_chunk->get_segment(column_id));
+    if (!is_reference_column) {
+      output_chunk.add_segment(std::make_shared<ReferenceSegment>(input_table, column_id, pos_list));
+      continue;
+    }
+
+    std::vector<std::shared_ptr<const ReferenceSegment>> input_segments;
+    std::vector<const PosList*> input_pos_lists;
+    for (auto chunk_id = ChunkID{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+      const auto input_segment =
+          std::dynamic_pointer_cast<const ReferenceSegment>(input_table->get_chunk(chunk_id)->get_segment(column_id));
+      DebugAssert(input_segment, "Tables must not mix ReferenceSegments and other segments within a column");
+      input_segments.push_back(input_segment);
+      input_pos_lists.push_back(input_segment->pos_list().get());
+    }
+
+    auto& resolved_pos_list = resolved_pos_lists[input_pos_lists];
+    if (!resolved_pos_list) {
+      auto new_pos_list = std::make_shared<PosList>();
+      new_pos_list->reserve(pos_list->size());
+      for (const auto& row_id : *pos_list) {
+        if (row_id == NULL_ROW_ID) {
+          new_pos_list->push_back(NULL_ROW_ID);
+        } else {
+          new_pos_list->push_back((*input_pos_lists[row_id.chunk_id])[row_id.chunk_offset]);
+        }
+      }
+      resolved_pos_list = std::move(new_pos_list);
+    }
+
+    output_chunk.add_segment(std::make_shared<ReferenceSegment>(
+        input_segments[0]->referenced_table(), input_segments[0]->referenced_column_id(), resolved_pos_list));
+  }
+}
+
+void add_output_segments(Chunk& output_chunk, const Morsel& morsel, const std::shared_ptr<const PosList>& pos_list) {
+  DebugAssert(pos_list->references_single_chunk() && pos_list->common_chunk_id() == morsel.chunk_id,
+              "The positions have to be offsets within the chunk of the morsel");
+  std::unordered_map<const PosList*, std::shared_ptr<const PosList>> selected_pos_lists;
+
+  for (auto column_id = ColumnID{0}; column_id < morsel.column_ids.size(); ++column_id) {
+    const auto input_segment = column_id < morsel.chunk.column_count() ? morsel.chunk.get_segment(column_id) : nullptr;
+    const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(input_segment);
+    if (!reference_segment) {
+      output_chunk.add_segment(
+          std::make_shared<ReferenceSegment>(morsel.table, morsel.column_ids[column_id], pos_list));
+      continue;
+    }
+
+    auto& selected_pos_list = selected_pos_lists[reference_segment->pos_list().get()];
+    if (!selected_pos_list) selected_pos_list = select_positions(*reference_segment->pos_list(), *pos_list);
+    output_chunk.add_segment(std::make_shared<ReferenceSegment>(
+        reference_segment->referenced_table(), reference_segment->referenced_column_id(), selected_pos_list));
+  }
+}
+
+}  // namespace opossum
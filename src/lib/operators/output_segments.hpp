@@ -0,0 +1,31 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_streaming_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+class Table;
+
+// Adds one ReferenceSegment per column of the input table to the output chunk. The positions in pos_list point into
+// the input table. If the input table consists of ReferenceSegments, they are resolved so that the output references
+// the tables that store the values. Columns that share their position lists in the input also share the resolved
+// position list in the output. Positions may be NULL_ROW_ID, e.g., for rows of an outer join without a join partner.
+//
+// This is used by operators whose output rows come from arbitrary chunks of the input, e.g., JoinHash and Sort.
+void add_output_segments(Chunk& output_chunk, const std::shared_ptr<const Table>& input_table,
+                         const std::shared_ptr<const PosList>& pos_list);
+
+// Adds one ReferenceSegment per column of the morsel to the output chunk. pos_list holds offsets within the chunk of
+// the morsel, i.e., it references the single chunk morsel.chunk_id (see PosList). Columns that are stored in the
+// morsel's table share pos_list. For columns that are ReferenceSegments, the offsets select from the segment's
+// position list, so that the output references the tables that store the values instead of nesting references.
+// Columns that share their position list in the morsel also share the selected position list in the output.
+//
+// This is used by operators that filter the rows of each chunk, e.g., TableScan.
+void add_output_segments(Chunk& output_chunk, const Morsel& morsel, const std::shared_ptr<const PosList>& pos_list);
+
+}  // namespace opossum
@@ -0,0 +1,85 @@
+#include "pipeline.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Returns the first input of the root that is not a streaming operator
+std::shared_ptr<const AbstractOperator> pipeline_source(const std::shared_ptr<const AbstractOperator>& root) {
+  Assert(root, "Pipeline: No root operator given");
+  auto source = root->input_left();
+  while (std::dynamic_pointer_cast<const AbstractStreamingOperator>(source)) source = source->input_left();
+  return source;
+}
+
+}  // namespace
+
+Pipeline::Pipeline(const std::shared_ptr<const AbstractOperator>& root) : AbstractOperator(pipeline_source(root)) {
+  auto op = root;
+  if (const auto sink = std::dynamic_pointer_cast<const AbstractSinkOperator>(root)) {
+    _sink = sink;
+    op = root->input_left();
+  }
+  while (const auto streaming_operator = std::dynamic_pointer_cast<const AbstractStreamingOperator>(op)) {
+    _streaming_operators.push_back(streaming_operator);
+    op = op->input_left();
+  }
+  std::reverse(_streaming_operators.begin(), _streaming_operators.end());
+
+  Assert(_sink || !_streaming_operators.empty(), "Pipeline: The root has to be a streaming operator or a sink");
+}
+
+const std::vector<std::shared_ptr<const AbstractStreamingOperator>>& Pipeline::streaming_operators() const {
+  return _streaming_operators;
+}
+
+const std::shared_ptr<const AbstractSinkOperator>& Pipeline::sink() const { return _sink; }
+
+const std::string Pipeline::name() const { return "Pipeline"; }
+
+std::string Pipeline::description() const {
+  std::stringstream stream;
+  stream << name() << " (";
+  for (auto index = size_t{0}; index < _streaming_operators.size(); ++index) {
+    stream << (index > 0 ? " -> " : "") << _streaming_operators[index]->description();
+  }
+  if (_sink) stream << (_streaming_operators.empty() ? "" : " -> ") << _sink->description();
+  stream << ")";
+  return stream.str();
+}
+
+std::shared_ptr<const Table> Pipeline::_on_execute() {
+  const auto source_table = _input_table_left();
+  Assert(source_table, "Pipeline: The source has to be executed first");
+
+  // The columns of the morsels before each streaming operator and after the last one
+  std::vector<std::shared_ptr<const Table>> input_tables{source_table};
+  std::shared_ptr<Table> output_table;
+  for (const auto& streaming_operator : _streaming_operators) {
+    output_table = streaming_operator->output_definition(*input_tables.back());
+    input_tables.push_back(output_table);
+  }
+
+  const auto producer = [&](const ChunkID chunk_id) {
+    auto morsel = make_morsel(source_table, chunk_id);
+    for (auto index = size_t{0}; index < _streaming_operators.size(); ++index) {
+      morsel = _streaming_operators[index]->process_morsel(*input_tables[index], std::move(morsel));
+    }
+    return morsel;
+  };
+
+  if (_sink) return _sink->consume(input_tables.back(), source_table->chunk_count(), producer);
+  return materialize_morsels(output_table, source_table->chunk_count(), producer);
+}
+
+}  // namespace opossum
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "abstract_sink_operator.hpp"
+#include "abstract_streaming_operator.hpp"
+
+namespace opossum {
+
+class Table;
+
+// Executes a chain of streaming operators, optionally followed by a sink, chunk at a time instead of operator at a
+// time. Each chunk of the source table is a morsel that one job pushes through all operators of the chain and then
+// hands to the sink, while its data is still in the cache. The morsels are processed in parallel on the WorkerPool.
+// The outputs of the operators within the pipeline are never materialized as tables, and the operators themselves are
+// not executed.
+//
+// Example (scan -> projection -> aggregate):
+//
+//   auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 5);
+//   auto projection = std::make_shared<Projection>(scan, std::vector<ColumnID>{ColumnID{1}, ColumnID{2}});
+//   auto aggregate = std::make_shared<Aggregate>(projection, aggregates, std::vector<ColumnID>{ColumnID{0}});
+//   auto pipeline = std::make_shared<Pipeline>(aggregate);
+//   pipeline->execute();  // returns the same table as aggregate->execute() would
+class Pipeline : public AbstractOperator {
+ public:
+  // The root is the last operator of the pipeline. It has to be a streaming operator or a sink. Its inputs belong to
+  // the pipeline as long as they are streaming operators. The first other input is the source of the pipeline, which
+  // has to be executed before the pipeline.
+  explicit Pipeline(const std::shared_ptr<const AbstractOperator>& root);
+
+  const std::string name() const override;
+
+  // lists the descriptions of the operators of the pipeline
+  std::string description() const override;
+
+  // returns the streaming operators in the order in which they process a morsel
+  const std::vector<std::shared_ptr<const AbstractStreamingOperator>>& streaming_operators() const;
+
+  // returns the sink, which is nullptr if the output of the last streaming operator is materialized
+  const std::shared_ptr<const AbstractSinkOperator>& sink() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::vector<std::shared_ptr<const AbstractStreamingOperator>> _streaming_operators;
+  std::shared_ptr<const AbstractSinkOperator> _sink;
+};
+
+}  // namespace opossum
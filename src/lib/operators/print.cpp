@@ -4,17 +4,40 @@
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <sstream>
 #include <string>
 #include <vector>
 
 #include "operators/table_wrapper.hpp"
+#include "resolve_type.hpp"
 #include "storage/base_segment.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
-#include "type_cast.hpp"
 #include "utils/performance_warning.hpp"
 
 namespace opossum {
 
+namespace {
+
+// Returns the printed representation of all values of a segment. The segment is read through segment_iterate so that
+// the values do not have to be boxed into AllTypeVariants one by one. Positions that segment_iterate skips are NULL.
+std::vector<std::string> segment_cells(const BaseSegment& segment, const std::string& column_type) {
+  std::vector<std::string> cells(segment.size(), "NULL");
+  resolve_data_type(column_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    auto stream = std::ostringstream{};
+    segment_iterate<Type>(segment, [&](const Type& value, const ChunkOffset chunk_offset) {
+      stream.str("");
+      stream << value;
+      cells[chunk_offset] = stream.str();
+    });
+  });
+  return cells;
+}
+
+}  // namespace
+
 Print::Print(const std::shared_ptr<const AbstractOperator> in, std::ostream& out) : AbstractOperator(in), _out(out) {}
 
 void Print::print(std::shared_ptr<const Table> table, std::ostream& out) {
@@ -23,6 +46,8 @@ void Print::print(std::shared_ptr<const Table> table, std::ostream& out) {
   Print(table_wrapper, out).execute();
 }
 
+const std::string Print::name() const { return "Print"; }
+
 std::shared_ptr<const Table> Print::_on_execute() {
   PerformanceWarningDisabler pwd;
 
@@ -41,22 +66,26 @@ std::shared_ptr<const Table> Print::_on_execute() {
 
   // print each chunk
   for (ChunkID chunk_id{0}; chunk_id < _input_table_left()->chunk_count(); ++chunk_id) {
-    const auto& chunk = _input_table_left()->get_chunk(chunk_id);
+    const auto chunk = _input_table_left()->get_chunk(chunk_id);
 
     _out << "=== Chunk " << chunk_id << " === " << std::endl;
 
-    if (chunk.size() == 0) {
+    if (chunk->size() == 0) {
       _out << "Empty chunk." << std::endl;
       continue;
     }
 
+    std::vector<std::vector<std::string>> columns;
+    for (ColumnID column_id{0}; column_id < chunk->column_count(); ++column_id) {
+      columns.emplace_back(
+          segment_cells(*chunk->get_segment(column_id), _input_table_left()->column_type(column_id)));
+    }
+
     // print the rows in the chunk
-    for (size_t row = 0; row < chunk.size(); ++row) {
+    for (size_t row = 0; row < chunk->size(); ++row) {
       _out << "|";
-      for (ColumnID column_id{0}; column_id < chunk.column_count(); ++column_id) {
-        // well yes, we use BaseSegment::operator[] here, but since Print is not an operation that should
-        // be part of a regular query plan, let's keep things simple here
-        _out << std::setw(widths[column_id]) << (*chunk.get_segment(column_id))[row] << "|" << std::setw(0);
+      for (ColumnID column_id{0}; column_id < chunk->column_count(); ++column_id) {
+        _out << std::setw(widths[column_id]) << columns[column_id][row] << "|" << std::setw(0);
       }
 
       _out << std::endl;
@@ -78,12 +107,11 @@ std::vector<uint16_t> Print::column_string_widths(uint16_t min, uint16_t max, st
 
   // go over all rows and find the maximum length of the printed representation of a value, up to max
   for (ChunkID chunk_id{0}; chunk_id < _input_table_left()->chunk_count(); ++chunk_id) {
-    auto& chunk = _input_table_left()->get_chunk(chunk_id);
+    const auto chunk = _input_table_left()->get_chunk(chunk_id);
 
-    for (ColumnID column_id{0}; column_id < chunk.column_count(); ++column_id) {
-      for (size_t row = 0; row < chunk.size(); ++row) {
-        auto cell_length =
-            static_cast<uint16_t>(boost::lexical_cast<std::string>((*chunk.get_segment(column_id))[row]).size());
+    for (ColumnID column_id{0}; column_id < chunk->column_count(); ++column_id) {
+      for (const auto& cell : segment_cells(*chunk->get_segment(column_id), t->column_type(column_id))) {
+        const auto cell_length = static_cast<uint16_t>(cell.size());
         widths[column_id] = std::max({min, widths[column_id], std::min(max, cell_length)});
       }
     }
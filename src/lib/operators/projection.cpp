@@ -0,0 +1,52 @@
+#include "projection.hpp"
+
+#include <memory>
+#include <string>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+Projection::Projection(const std::shared_ptr<const AbstractOperator> input, const std::vector<ColumnID>& column_ids)
+    : AbstractStreamingOperator(input), _column_ids(column_ids) {}
+
+const std::vector<ColumnID>& Projection::column_ids() const { return _column_ids; }
+
+const std::string Projection::name() const { return "Projection"; }
+
+std::string Projection::description() const {
+  std::stringstream stream;
+  stream << name() << " (";
+  for (auto index = size_t{0}; index < _column_ids.size(); ++index) {
+    stream << (index > 0 ? ", #" : "#") << _column_ids[index];
+  }
+  stream << ")";
+  return stream.str();
+}
+
+std::shared_ptr<Table> Projection::output_definition(const Table& input_table) const {
+  auto output_table = std::make_shared<Table>(input_table.max_chunk_size());
+  for (const auto& column_id : _column_ids) {
+    Assert(column_id < input_table.column_count(), "Projection: Unknown column");
+    output_table->add_column_definition(input_table.column_name(column_id), input_table.column_type(column_id));
+  }
+  return output_table;
+}
+
+Morsel Projection::process_morsel(const Table& input_table, Morsel morsel) const {
+  Morsel output_morsel{Chunk{}, morsel.table, morsel.chunk_id, {}};
+  for (const auto& column_id : _column_ids) {
+    // The empty first chunk of a table without rows may have no segments
+    if (column_id < morsel.chunk.column_count()) {
+      output_morsel.chunk.add_segment(morsel.chunk.get_segment(column_id), morsel.chunk.statistics(column_id));
+    }
+    output_morsel.column_ids.push_back(morsel.column_ids[column_id]);
+  }
+  return output_morsel;
+}
+
+}  // namespace opossum
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_streaming_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// Selects and reorders columns of the input. A column may be selected more than once.
+//
+// No values are copied: each output chunk holds the same segments as the corresponding input chunk, so the cost does
+// not depend on the number of rows. ReferenceSegments are shared as well, so their PosLists are not copied either.
+class Projection : public AbstractStreamingOperator {
+ public:
+  Projection(const std::shared_ptr<const AbstractOperator> input, const std::vector<ColumnID>& column_ids);
+
+  const std::vector<ColumnID>& column_ids() const;
+
+  const std::string name() const override;
+  std::string description() const override;
+
+  std::shared_ptr<Table> output_definition(const Table& input_table) const override;
+
+  Morsel process_morsel(const Table& input_table, Morsel morsel) const override;
+
+ protected:
+  const std::vector<ColumnID> _column_ids;
+};
+
+}  // namespace opossum
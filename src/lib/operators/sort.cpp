@@ -0,0 +1,461 @@
+#include "sort.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "output_segments.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/worker_pool.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/pos_list.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Partitions with at most this many rows are sorted by insertion sort instead of radix sort
+constexpr auto INSERTION_SORT_THRESHOLD = size_t{32};
+
+// The part of the normalized key that belongs to one sort column: a byte that orders NULLs after all values,
+// followed by the bytes of the value
+struct KeyColumn {
+  ColumnID column_id;
+  bool descending;
+  // position of the NULL byte within the key
+  size_t offset;
+  // number of value bytes
+  size_t width;
+  // all distinct strings of a string column, sorted. A string is encoded as its index in this list.
+  std::vector<std::string> distinct_strings;
+};
+
+template <typename T>
+constexpr size_t value_width() {
+  if constexpr (std::is_same_v<T, std::string>) {
+    return sizeof(uint32_t);
+  } else {
+    return sizeof(T);
+  }
+}
+
+template <typename Bits>
+void write_big_endian(const Bits bits, uint8_t* out) {
+  for (auto index = size_t{0}; index < sizeof(Bits); ++index) {
+    out[index] = static_cast<uint8_t>(bits >> (8 * (sizeof(Bits) - 1 - index)));
+  }
+}
+
+// Writes the value bytes of a value, so that memcmp on them orders the values ascendingly
+template <typename T>
+void encode_value(const T& value, const KeyColumn& column, uint8_t* out) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    const auto& strings = column.distinct_strings;
+    const auto rank = std::lower_bound(strings.cbegin(), strings.cend(), value) - strings.cbegin();
+    write_big_endian(static_cast<uint32_t>(rank), out);
+  } else {
+    using Bits = std::conditional_t<sizeof(T) == sizeof(uint64_t), uint64_t, uint32_t>;
+    constexpr auto sign_bit = Bits{1} << (sizeof(Bits) * 8 - 1);
+
+    Bits bits;
+    if constexpr (std::is_floating_point_v<T>) {
+      // -0.0 and 0.0 are equal, so they have to get the same key
+      const auto normalized_value = value == T{0} ? T{0} : value;
+      std::memcpy(&bits, &normalized_value, sizeof(Bits));
+      // Negative numbers are stored as sign and magnitude, so all of their bits have to be flipped
+      bits = (bits & sign_bit) ? ~bits : bits | sign_bit;
+    } else {
+      std::memcpy(&bits, &value, sizeof(Bits));
+      bits ^= sign_bit;
+    }
+    write_big_endian(bits, out);
+  }
+}
+
+// Writes the key bytes of one column for all rows of a segment. chunk_keys points to the key of the first row.
+template <typename T>
+void encode_segment(const BaseSegment& segment, const KeyColumn& column, uint8_t* chunk_keys, const size_t key_width) {
+  // Descending columns get the complement of the ascending bytes
+  const auto flip = static_cast<uint8_t>(column.descending ? 0xFF : 0x00);
+  const auto write_key = [&](const ChunkOffset chunk_offset, const uint8_t* value_bytes) {
+    auto key = chunk_keys + chunk_offset * key_width + column.offset;
+    key[0] = flip;
+    for (auto index = size_t{0}; index < column.width; ++index) key[index + 1] = value_bytes[index] ^ flip;
+  };
+
+  // NULL positions are skipped below, so all rows start as NULL
+  for (auto chunk_offset = size_t{0}; chunk_offset < segment.size(); ++chunk_offset) {
+    chunk_keys[chunk_offset * key_width + column.offset] = 1 ^ flip;
+  }
+
+  // Values are encoded once per dictionary entry and then looked up by ValueID
+  if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    const auto dictionary = dictionary_segment->decoded_dictionary();
+    std::vector<uint8_t> dictionary_keys(dictionary->size() * column.width);
+    for (auto value_id = size_t{0}; value_id < dictionary->size(); ++value_id) {
+      encode_value((*dictionary)[value_id], column, &dictionary_keys[value_id * column.width]);
+    }
+    detail::resolve_attribute_vector(*dictionary_segment->attribute_vector(), [&](const auto& attribute_vector) {
+      detail::value_ids_iterate(attribute_vector, [&](const auto value_id, const ChunkOffset chunk_offset) {
+        write_key(chunk_offset, &dictionary_keys[value_id * column.width]);
+      });
+    });
+    return;
+  }
+
+  std::array<uint8_t, sizeof(uint64_t)> value_bytes;
+  segment_iterate<T>(segment, [&](const T& value, const ChunkOffset chunk_offset) {
+    encode_value(value, column, value_bytes.data());
+    write_key(chunk_offset, value_bytes.data());
+  });
+}
+
+// Returns the sorted distinct non-NULL strings of a segment
+std::vector<std::string> distinct_strings(const BaseSegment& segment) {
+  std::vector<std::string> strings;
+  if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<std::string>*>(&segment)) {
+    const auto dictionary = dictionary_segment->decoded_dictionary();
+    strings.assign(dictionary->cbegin(), dictionary->cend());
+    return strings;
+  }
+
+  segment_iterate<std::string>(segment, [&](const std::string& value, const ChunkOffset) { strings.push_back(value); });
+  std::sort(strings.begin(), strings.end());
+  strings.erase(std::unique(strings.begin(), strings.end()), strings.end());
+  return strings;
+}
+
+// Stably sorts the rows of one partition by their keys, which are key_width bytes wide. The keys are reordered, too.
+void sort_partition(uint8_t* keys, RowID* row_ids, const size_t row_count, const size_t key_width) {
+  if (row_count <= 1 || key_width == 0) return;
+
+  if (row_count <= INSERTION_SORT_THRESHOLD) {
+    std::vector<uint8_t> key(key_width);
+    for (auto index = size_t{1}; index < row_count; ++index) {
+      std::memcpy(key.data(), keys + index * key_width, key_width);
+      const auto row_id = row_ids[index];
+      auto position = index;
+      while (position > 0 && std::memcmp(keys + (position - 1) * key_width, key.data(), key_width) > 0) {
+        std::memcpy(keys + position * key_width, keys + (position - 1) * key_width, key_width);
+        row_ids[position] = row_ids[position - 1];
+        --position;
+      }
+      std::memcpy(keys + position * key_width, key.data(), key_width);
+      row_ids[position] = row_id;
+    }
+    return;
+  }
+
+  // LSD radix sort, one byte per pass, starting with the last byte
+  std::vector<uint8_t> key_buffer(row_count * key_width);
+  std::vector<RowID> row_id_buffer(row_count);
+  auto source_keys = keys;
+  auto source_row_ids = row_ids;
+  auto target_keys = key_buffer.data();
+  auto target_row_ids = row_id_buffer.data();
+
+  for (auto byte_index = key_width; byte_index-- > 0;) {
+    std::array<size_t, 256> offsets{};
+    for (auto index = size_t{0}; index < row_count; ++index) ++offsets[source_keys[index * key_width + byte_index]];
+    // If all rows have the same byte, this pass would not change their order
+    if (std::find(offsets.cbegin(), offsets.cend(), row_count) != offsets.cend()) continue;
+
+    auto offset = size_t{0};
+    for (auto& bucket_offset : offsets) {
+      const auto bucket_size = bucket_offset;
+      bucket_offset = offset;
+      offset += bucket_size;
+    }
+    for (auto index = size_t{0}; index < row_count; ++index) {
+      const auto target_index = offsets[source_keys[index * key_width + byte_index]]++;
+      std::memcpy(target_keys + target_index * key_width, source_keys + index * key_width, key_width);
+      target_row_ids[target_index] = source_row_ids[index];
+    }
+    std::swap(source_keys, target_keys);
+    std::swap(source_row_ids, target_row_ids);
+  }
+
+  if (source_row_ids != row_ids) {
+    std::copy(source_row_ids, source_row_ids + row_count, row_ids);
+    std::memcpy(keys, source_keys, row_count * key_width);
+  }
+}
+
+}  // namespace
+
+Sort::Sort(const std::shared_ptr<const AbstractOperator> input,
+           const std::vector<SortColumnDefinition>& sort_definitions, const SortOutputMode output_mode)
+    : AbstractOperator(input), _sort_definitions(sort_definitions), _output_mode(output_mode) {}
+
+const std::vector<SortColumnDefinition>& Sort::sort_definitions() const { return _sort_definitions; }
+
+SortOutputMode Sort::output_mode() const { return _output_mode; }
+
+const std::string Sort::name() const { return "Sort"; }
+
+std::string Sort::description() const {
+  std::stringstream stream;
+  stream << name() << " (";
+  for (auto index = size_t{0}; index < _sort_definitions.size(); ++index) {
+    const auto& definition = _sort_definitions[index];
+    stream << (index > 0 ? ", #" : "#") << definition.column_id
+           << (definition.order_by_mode == OrderByMode::Ascending ? " ASC" : " DESC");
+  }
+  if (_output_mode == SortOutputMode::Materialized) stream << ", materialized";
+  stream << ")";
+  return stream.str();
+}
+
+std::shared_ptr<const Table> Sort::_on_execute() {
+  const auto input_table = _input_table_left();
+  Assert(!_sort_definitions.empty(), "Sort: No sort columns given");
+
+  auto key_width = size_t{0};
+  std::vector<KeyColumn> key_columns;
+  for (const auto& definition : _sort_definitions) {
+    Assert(definition.column_id < input_table->column_count(), "Sort: Unknown sort column");
+    auto width = size_t{0};
+    resolve_data_type(input_table->column_type(definition.column_id), [&](auto type) {
+      using Type = typename decltype(type)::type;
+      width = value_width<Type>();
+    });
+    key_columns.push_back(
+        KeyColumn{definition.column_id, definition.order_by_mode == OrderByMode::Descending, key_width, width, {}});
+    key_width += 1 + width;
+  }
+
+  const auto chunk_count = input_table->chunk_count();
+  std::vector<size_t> chunk_begins(chunk_count + 1);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    chunk_begins[chunk_id + 1] = chunk_begins[chunk_id] + input_table->get_chunk(chunk_id)->size();
+  }
+  const auto row_count = chunk_begins.back();
+
+  // Strings are encoded by their rank among all distinct strings of the column
+  for (auto& key_column : key_columns) {
+    if (input_table->column_type(key_column.column_id) != "string") continue;
+
+    std::vector<std::vector<std::string>> chunk_strings(chunk_count);
+    std::vector<std::function<void()>> jobs;
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      jobs.emplace_back([&, chunk_id]() {
+        const auto chunk = input_table->get_chunk(chunk_id);
+        if (chunk->size() == 0) return;
+        chunk_strings[chunk_id] = distinct_strings(*chunk->get_segment(key_column.column_id));
+      });
+    }
+    WorkerPool::get().run_and_wait(jobs);
+
+    // The strings of the chunks are merged pairwise in a tree. Each string is thus moved log(chunk count) times, and
+    // the merges of a level run in parallel.
+    for (auto step = size_t{1}; step < chunk_strings.size(); step *= 2) {
+      jobs.clear();
+      for (auto left = size_t{0}; left + step < chunk_strings.size(); left += 2 * step) {
+        jobs.emplace_back([&, left, step]() {
+          auto& left_strings = chunk_strings[left];
+          auto& right_strings = chunk_strings[left + step];
+          std::vector<std::string> strings;
+          strings.reserve(left_strings.size() + right_strings.size());
+          // Both inputs are sorted and distinct, so their union is, too
+          std::set_union(std::make_move_iterator(left_strings.begin()), std::make_move_iterator(left_strings.end()),
+                         std::make_move_iterator(right_strings.begin()), std::make_move_iterator(right_strings.end()),
+                         std::back_inserter(strings));
+          left_strings = std::move(strings);
+          right_strings = std::vector<std::string>{};
+        });
+      }
+      WorkerPool::get().run_and_wait(jobs);
+    }
+    if (!chunk_strings.empty()) key_column.distinct_strings = std::move(chunk_strings.front());
+  }
+
+  // Encode the keys of each chunk and find the bytes that differ from the first key of the chunk
+  std::vector<uint8_t> keys(row_count * key_width);
+  std::vector<std::vector<uint8_t>> chunk_varying_bytes(chunk_count, std::vector<uint8_t>(key_width));
+  {
+    std::vector<std::function<void()>> jobs;
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      jobs.emplace_back([&, chunk_id]() {
+        const auto chunk = input_table->get_chunk(chunk_id);
+        if (chunk->size() == 0) return;
+
+        const auto chunk_keys = keys.data() + chunk_begins[chunk_id] * key_width;
+        for (const auto& key_column : key_columns) {
+          resolve_data_type(input_table->column_type(key_column.column_id), [&](auto type) {
+            using Type = typename decltype(type)::type;
+            encode_segment<Type>(*chunk->get_segment(key_column.column_id), key_column, chunk_keys, key_width);
+          });
+        }
+
+        auto& varying_bytes = chunk_varying_bytes[chunk_id];
+        for (auto chunk_offset = size_t{1}; chunk_offset < chunk->size(); ++chunk_offset) {
+          for (auto index = size_t{0}; index < key_width; ++index) {
+            varying_bytes[index] |= chunk_keys[chunk_offset * key_width + index] ^ chunk_keys[index];
+          }
+        }
+      });
+    }
+    WorkerPool::get().run_and_wait(jobs);
+  }
+
+  // Bytes that are equal in all keys do not affect the order and are skipped
+  std::vector<size_t> key_bytes;
+  if (row_count > 0) {
+    std::vector<uint8_t> varying_bytes(key_width);
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      if (chunk_begins[chunk_id] == chunk_begins[chunk_id + 1]) continue;
+      const auto first_key = keys.data() + chunk_begins[chunk_id] * key_width;
+      for (auto index = size_t{0}; index < key_width; ++index) {
+        varying_bytes[index] |= chunk_varying_bytes[chunk_id][index] | (first_key[index] ^ keys[index]);
+      }
+    }
+    for (auto index = size_t{0}; index < key_width; ++index) {
+      if (varying_bytes[index]) key_bytes.push_back(index);
+    }
+  }
+
+  auto sorted_row_ids = std::vector<RowID>(row_count);
+  if (key_bytes.empty()) {
+    // All keys are equal, so the input order is kept
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      for (auto index = chunk_begins[chunk_id]; index < chunk_begins[chunk_id + 1]; ++index) {
+        sorted_row_ids[index] = RowID{chunk_id, static_cast<ChunkOffset>(index - chunk_begins[chunk_id])};
+      }
+    }
+  } else {
+    // Partition the rows by their first varying key byte. The remaining varying bytes are copied into a compact key.
+    const auto partition_byte = key_bytes.front();
+    const auto compact_key_width = key_bytes.size() - 1;
+
+    std::vector<std::array<size_t, 256>> chunk_histograms(chunk_count);
+    {
+      std::vector<std::function<void()>> jobs;
+      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+        jobs.emplace_back([&, chunk_id]() {
+          auto& histogram = chunk_histograms[chunk_id];
+          histogram.fill(0);
+          for (auto index = chunk_begins[chunk_id]; index < chunk_begins[chunk_id + 1]; ++index) {
+            ++histogram[keys[index * key_width + partition_byte]];
+          }
+        });
+      }
+      WorkerPool::get().run_and_wait(jobs);
+    }
+
+    // The rows of a partition are written in chunk order, so that the partitioning is stable
+    std::array<size_t, 257> partition_begins{};
+    std::vector<std::array<size_t, 256>> chunk_write_offsets(chunk_count);
+    auto offset = size_t{0};
+    for (auto partition = size_t{0}; partition < 256; ++partition) {
+      partition_begins[partition] = offset;
+      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+        chunk_write_offsets[chunk_id][partition] = offset;
+        offset += chunk_histograms[chunk_id][partition];
+      }
+    }
+    partition_begins[256] = offset;
+
+    std::vector<uint8_t> compact_keys(row_count * compact_key_width);
+    {
+      std::vector<std::function<void()>> jobs;
+      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+        jobs.emplace_back([&, chunk_id]() {
+          auto& write_offsets = chunk_write_offsets[chunk_id];
+          for (auto index = chunk_begins[chunk_id]; index < chunk_begins[chunk_id + 1]; ++index) {
+            const auto key = keys.data() + index * key_width;
+            const auto target_index = write_offsets[key[partition_byte]]++;
+            const auto compact_key = compact_keys.data() + target_index * compact_key_width;
+            for (auto byte = size_t{0}; byte < compact_key_width; ++byte) compact_key[byte] = key[key_bytes[byte + 1]];
+            sorted_row_ids[target_index] = RowID{chunk_id, static_cast<ChunkOffset>(index - chunk_begins[chunk_id])};
+          }
+        });
+      }
+      WorkerPool::get().run_and_wait(jobs);
+    }
+    keys = std::vector<uint8_t>{};
+
+    // Sort each partition by the remaining bytes
+    std::vector<std::function<void()>> jobs;
+    for (auto partition = size_t{0}; partition < 256; ++partition) {
+      const auto partition_size = partition_begins[partition + 1] - partition_begins[partition];
+      if (partition_size <= 1 || compact_key_width == 0) continue;
+      jobs.emplace_back([&, partition, partition_size]() {
+        const auto begin = partition_begins[partition];
+        sort_partition(compact_keys.data() + begin * compact_key_width, sorted_row_ids.data() + begin, partition_size,
+                       compact_key_width);
+      });
+    }
+    WorkerPool::get().run_and_wait(jobs);
+  }
+
+  // Split the sorted rows into output chunks
+  auto output_table = std::make_shared<Table>(input_table->max_chunk_size());
+  for (auto column_id = ColumnID{0}; column_id < input_table->column_count(); ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+
+  const auto output_chunk_size = size_t{input_table->max_chunk_size()};
+  std::vector<Chunk> output_chunks;
+  for (auto begin = size_t{0}; begin < row_count; begin += output_chunk_size) {
+    const auto end = std::min(begin + output_chunk_size, row_count);
+    auto pos_list = row_count <= output_chunk_size
+                        ? std::make_shared<PosList>(std::move(sorted_row_ids))
+                        : std::make_shared<PosList>(
+                              std::vector<RowID>(sorted_row_ids.cbegin() + begin, sorted_row_ids.cbegin() + end));
+    Chunk output_chunk;
+    add_output_segments(output_chunk, input_table, pos_list);
+    output_chunks.push_back(std::move(output_chunk));
+  }
+  if (output_chunks.empty()) {
+    Chunk output_chunk;
+    add_output_segments(output_chunk, input_table, std::make_shared<PosList>());
+    output_chunks.push_back(std::move(output_chunk));
+  }
+
+  if (_output_mode == SortOutputMode::Materialized) {
+    // Jobs must not throw, so NULLs are only reported once all jobs are done
+    std::vector<uint8_t> chunk_has_nulls(output_chunks.size());
+    std::vector<std::function<void()>> jobs;
+    for (auto chunk_index = size_t{0}; chunk_index < output_chunks.size(); ++chunk_index) {
+      jobs.emplace_back([&, chunk_index]() {
+        const auto& reference_chunk = output_chunks[chunk_index];
+        Chunk output_chunk;
+        for (auto column_id = ColumnID{0}; column_id < input_table->column_count(); ++column_id) {
+          resolve_data_type(input_table->column_type(column_id), [&](auto type) {
+            using Type = typename decltype(type)::type;
+            const auto& segment = *reference_chunk.get_segment(column_id);
+            std::vector<Type> values(segment.size());
+            auto value_count = size_t{0};
+            segment_iterate<Type>(segment, [&](const Type& value, const ChunkOffset chunk_offset) {
+              values[chunk_offset] = value;
+              ++value_count;
+            });
+            if (value_count != values.size()) chunk_has_nulls[chunk_index] = true;
+            output_chunk.add_segment(std::make_shared<ValueSegment<Type>>(std::move(values)));
+          });
+        }
+        output_chunks[chunk_index] = std::move(output_chunk);
+      });
+    }
+    WorkerPool::get().run_and_wait(jobs);
+    const auto has_nulls = std::find(chunk_has_nulls.cbegin(), chunk_has_nulls.cend(), true) != chunk_has_nulls.cend();
+    Assert(!has_nulls, "Sort: ValueSegments cannot hold NULLs, use SortOutputMode::References instead");
+  }
+
+  for (auto& output_chunk : output_chunks) output_table->emplace_chunk(std::move(output_chunk));
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+struct SortColumnDefinition {
+  ColumnID column_id;
+  OrderByMode order_by_mode = OrderByMode::Ascending;
+};
+
+// Sorts the rows of the input by one or more columns. Rows with equal sort keys keep their input order. NULLs are
+// greater than all values, i.e., they come last in ascending and first in descending order.
+//
+// The sort columns of each row are encoded into a fixed-width normalized key whose bytes compare like the rows, i.e.,
+// a plain byte-wise comparison of two keys replaces the comparison of the typed values column by column. Numbers are
+// stored big-endian with their sign bit flipped. Strings are replaced by their rank among all distinct strings of the
+// column. For DictionarySegments, the key bytes are computed once per dictionary entry and looked up by ValueID, so
+// the values are never decoded row by row. Bytes that are equal in all keys are dropped before sorting.
+//
+// The keys are first partitioned by their first byte, which is parallelized per chunk. Each partition is then
+// radix-sorted by its remaining bytes in a job of its own on the WorkerPool.
+//
+// The output is split into chunks of the input's maximum chunk size. With SortOutputMode::Materialized, the values are
+// copied into ValueSegments, which requires that the input contains no NULLs.
+class Sort : public AbstractOperator {
+ public:
+  Sort(const std::shared_ptr<const AbstractOperator> input, const std::vector<SortColumnDefinition>& sort_definitions,
+       const SortOutputMode output_mode = SortOutputMode::References);
+
+  const std::vector<SortColumnDefinition>& sort_definitions() const;
+  SortOutputMode output_mode() const;
+
+  const std::string name() const override;
+  std::string description() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::vector<SortColumnDefinition> _sort_definitions;
+  const SortOutputMode _output_mode;
+};
+
+}  // namespace opossum
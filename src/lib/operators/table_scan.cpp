@@ -0,0 +1,373 @@
+#include "table_scan.hpp"
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/bit_packed_attribute_vector.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/fixed_size_attribute_vector.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/pos_list.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "output_segments.hpp"
+#include "table_scan_value_id_kernel.hpp"
+#include "type_cast.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Calls the functor with the comparison function object that belongs to the scan type. This way, the comparison is
+// resolved once per segment instead of once per row and can be inlined into the scan loop.
+template <typename T, typename Functor>
+void resolve_comparator(const ScanType scan_type, const Functor& functor) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return functor(std::equal_to<T>{});
+    case ScanType::OpNotEquals:
+      return functor(std::not_equal_to<T>{});
+    case ScanType::OpLessThan:
+      return functor(std::less<T>{});
+    case ScanType::OpLessThanEquals:
+      return functor(std::less_equal<T>{});
+    case ScanType::OpGreaterThan:
+      return functor(std::greater<T>{});
+    case ScanType::OpGreaterThanEquals:
+      return functor(std::greater_equal<T>{});
+  }
+  Fail("Unknown scan type");
+}
+
+}  // namespace
+
+// The part of the scan that depends on the data type of the scanned column. It is instantiated once per execution.
+class BaseTableScanImpl {
+ public:
+  virtual ~BaseTableScanImpl() = default;
+
+  // Returns whether the zone map of the scanned segment rules out any matching row, so the chunk can be skipped
+  virtual bool can_prune(const Chunk& chunk) const = 0;
+
+  // Returns the offsets of all matching rows within the chunk as a position list that references only that chunk (see
+  // PosList).
+  virtual std::shared_ptr<PosList> scan_chunk(const Chunk& chunk, const ChunkID chunk_id) const = 0;
+};
+
+template <typename T>
+class TableScanImpl : public BaseTableScanImpl {
+ public:
+  TableScanImpl(const ColumnID column_id, const ScanType scan_type, const AllTypeVariant& search_value)
+      : _column_id(column_id), _scan_type(scan_type), _search_value(type_cast<T>(search_value)) {}
+
+  bool can_prune(const Chunk& chunk) const override {
+    const auto statistics = chunk.statistics(_column_id);
+    if (!statistics) return false;
+
+    const auto min = type_cast<T>(statistics->min);
+    const auto max = type_cast<T>(statistics->max);
+    switch (_scan_type) {
+      case ScanType::OpEquals:
+        return _search_value < min || _search_value > max;
+      case ScanType::OpNotEquals:
+        return min == _search_value && max == _search_value;
+      case ScanType::OpLessThan:
+        return min >= _search_value;
+      case ScanType::OpLessThanEquals:
+        return min > _search_value;
+      case ScanType::OpGreaterThan:
+        return max <= _search_value;
+      case ScanType::OpGreaterThanEquals:
+        return max < _search_value;
+    }
+    Fail("Unknown scan type");
+    return false;
+  }
+
+  std::shared_ptr<PosList> scan_chunk(const Chunk& chunk, const ChunkID chunk_id) const override {
+    const auto segment = chunk.get_segment(_column_id);
+    auto pos_list = std::make_shared<PosList>(chunk_id);
+
+    // FrameOfReferenceSegments only exist for integer types
+    if constexpr (std::is_integral_v<T>) {
+      if (const auto frame_of_reference_segment =
+              std::dynamic_pointer_cast<const FrameOfReferenceSegment<T>>(segment)) {
+        _scan_frame_of_reference_segment(*frame_of_reference_segment, *pos_list);
+        return pos_list;
+      }
+    }
+
+    if (const auto value_segment = std::dynamic_pointer_cast<const ValueSegment<T>>(segment)) {
+      _scan_value_segment(*value_segment, *pos_list);
+    } else if (const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<T>>(segment)) {
+      _scan_dictionary_segment(*dictionary_segment, *pos_list);
+    } else if (const auto run_length_segment = std::dynamic_pointer_cast<const RunLengthSegment<T>>(segment)) {
+      _scan_run_length_segment(*run_length_segment, *pos_list);
+    } else if (const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment)) {
+      _scan_reference_segment(*reference_segment, *pos_list);
+    } else {
+      Fail("TableScan does not support this segment type");
+    }
+
+    return pos_list;
+  }
+
+ protected:
+  void _scan_value_segment(const ValueSegment<T>& segment, PosList& pos_list) const {
+    const auto& values = segment.values();
+    // preallocated segments hold more slots than published values
+    const auto value_count = segment.size();
+    resolve_comparator<T>(_scan_type, [&](const auto comparator) {
+      for (ChunkOffset chunk_offset{0}; chunk_offset < value_count; ++chunk_offset) {
+        if (comparator(values[chunk_offset], _search_value)) pos_list.push_back(chunk_offset);
+      }
+    });
+  }
+
+  // Instead of decoding every value, the search value is translated into a range of value ids once per segment.
+  // Because the dictionary is sorted, every scan type matches either a contiguous range of value ids or (for
+  // OpNotEquals) everything but such a range. The packed value ids are then compared by a SIMD kernel.
+  void _scan_dictionary_segment(const DictionarySegment<T>& segment, PosList& pos_list) const {
+    const auto dictionary_size = ValueID{static_cast<ValueID::base_type>(segment.unique_values_count())};
+
+    // lower_bound and upper_bound return INVALID_VALUE_ID if no value is large enough, which equals the end of the
+    // dictionary for our purposes
+    auto lower_bound = segment.lower_bound(_search_value);
+    if (lower_bound == INVALID_VALUE_ID) lower_bound = dictionary_size;
+    auto upper_bound = segment.upper_bound(_search_value);
+    if (upper_bound == INVALID_VALUE_ID) upper_bound = dictionary_size;
+
+    auto range_begin = ValueID{0};
+    auto range_end = dictionary_size;
+    auto negate = false;
+
+    switch (_scan_type) {
+      case ScanType::OpEquals:
+        range_begin = lower_bound;
+        range_end = upper_bound;
+        break;
+      case ScanType::OpNotEquals:
+        range_begin = lower_bound;
+        range_end = upper_bound;
+        negate = true;
+        break;
+      case ScanType::OpLessThan:
+        range_end = lower_bound;
+        break;
+      case ScanType::OpLessThanEquals:
+        range_end = upper_bound;
+        break;
+      case ScanType::OpGreaterThan:
+        range_begin = upper_bound;
+        break;
+      case ScanType::OpGreaterThanEquals:
+        range_begin = lower_bound;
+        break;
+    }
+
+    const auto scan_value_ids = [&](const auto& value_ids) {
+      scan_value_id_range(value_ids.data(), value_ids.size(), range_begin, range_end, negate, ChunkOffset{0}, pos_list);
+    };
+
+    const auto attribute_vector = segment.attribute_vector();
+    if (const auto uint8_vector =
+            std::dynamic_pointer_cast<const FixedSizeAttributeVector<uint8_t>>(attribute_vector)) {
+      scan_value_ids(uint8_vector->values());
+    } else if (const auto uint16_vector =
+                   std::dynamic_pointer_cast<const FixedSizeAttributeVector<uint16_t>>(attribute_vector)) {
+      scan_value_ids(uint16_vector->values());
+    } else if (const auto uint32_vector =
+                   std::dynamic_pointer_cast<const FixedSizeAttributeVector<uint32_t>>(attribute_vector)) {
+      scan_value_ids(uint32_vector->values());
+    } else if (const auto bit_packed_vector =
+                   std::dynamic_pointer_cast<const BitPackedAttributeVector>(attribute_vector)) {
+      // Bit-packed value ids are unpacked block by block into a buffer that stays in the cache and scanned from there
+      std::array<uint32_t, 1024> value_ids;
+      for (auto first_index = size_t{0}; first_index < bit_packed_vector->size(); first_index += value_ids.size()) {
+        const auto count = std::min(value_ids.size(), bit_packed_vector->size() - first_index);
+        bit_packed_vector->decode(first_index, count, value_ids.data());
+        scan_value_id_range(value_ids.data(), count, range_begin, range_end, negate,
+                            static_cast<ChunkOffset>(first_index), pos_list);
+      }
+    } else {
+      Fail("TableScan does not support this attribute vector type");
+    }
+  }
+
+  // The predicate is evaluated once per run. The positions of matching runs are emitted as a whole.
+  void _scan_run_length_segment(const RunLengthSegment<T>& segment, PosList& pos_list) const {
+    const auto& values = *segment.values();
+    const auto& end_positions = *segment.end_positions();
+    resolve_comparator<T>(_scan_type, [&](const auto comparator) {
+      auto run_begin = ChunkOffset{0};
+      for (auto run_index = size_t{0}; run_index < values.size(); ++run_index) {
+        const auto run_end = end_positions[run_index] + 1;
+        if (comparator(values[run_index], _search_value)) pos_list.push_back_range(run_begin, run_end);
+        run_begin = run_end;
+      }
+    });
+  }
+
+  // The search value is translated into a range of offsets once per block, just like the dictionary scan translates it
+  // into a range of value ids. Blocks that match completely or not at all are handled without decoding the offsets.
+  void _scan_frame_of_reference_segment(const FrameOfReferenceSegment<T>& segment, PosList& pos_list) const {
+    constexpr auto block_size = FrameOfReferenceSegment<T>::BLOCK_SIZE;
+    const auto& block_minima = *segment.block_minima();
+    const auto& offsets = *segment.offsets();
+    // The number of offsets that the bit width can represent. As the bit width is at most 31, this fits a ValueID.
+    const auto offset_count = uint64_t{1} << offsets.bit_width();
+
+    std::array<uint32_t, block_size> block_offsets;
+    for (auto block_index = size_t{0}; block_index < block_minima.size(); ++block_index) {
+      const auto minimum = block_minima[block_index];
+      const auto first_index = block_index * block_size;
+      const auto count = std::min(block_size, segment.size() - first_index);
+
+      // less is the number of offsets that encode values smaller than the search value, less_equals also includes the
+      // offset of the search value itself. The subtraction is unsigned so that it cannot overflow.
+      auto less = uint64_t{0};
+      auto less_equals = uint64_t{0};
+      if (_search_value >= minimum) {
+        using Unsigned = std::make_unsigned_t<T>;
+        const auto difference = static_cast<uint64_t>(
+            static_cast<Unsigned>(static_cast<Unsigned>(_search_value) - static_cast<Unsigned>(minimum)));
+        less = std::min(difference, offset_count);
+        less_equals = std::min(difference, offset_count - 1) + 1;
+      }
+
+      auto range_begin = uint64_t{0};
+      auto range_end = offset_count;
+      auto negate = false;
+      switch (_scan_type) {
+        case ScanType::OpEquals:
+          range_begin = less;
+          range_end = less_equals;
+          break;
+        case ScanType::OpNotEquals:
+          range_begin = less;
+          range_end = less_equals;
+          negate = true;
+          break;
+        case ScanType::OpLessThan:
+          range_end = less;
+          break;
+        case ScanType::OpLessThanEquals:
+          range_end = less_equals;
+          break;
+        case ScanType::OpGreaterThan:
+          range_begin = less_equals;
+          break;
+        case ScanType::OpGreaterThanEquals:
+          range_begin = less;
+          break;
+      }
+
+      const auto range_is_empty = range_begin >= range_end;
+      const auto range_is_full = range_begin == 0 && range_end == offset_count;
+      if (negate ? range_is_full : range_is_empty) continue;
+      if (negate ? range_is_empty : range_is_full) {
+        pos_list.push_back_range(static_cast<ChunkOffset>(first_index), static_cast<ChunkOffset>(first_index + count));
+        continue;
+      }
+
+      offsets.decode(first_index, count, block_offsets.data());
+      scan_value_id_range(block_offsets.data(), count, ValueID{static_cast<ValueID::base_type>(range_begin)},
+                          ValueID{static_cast<ValueID::base_type>(range_end)}, negate,
+                          static_cast<ChunkOffset>(first_index), pos_list);
+    }
+  }
+
+  // Evaluates the predicate on the referenced values, which are resolved chunk by chunk. Like for the other segment
+  // types, the offsets within the scanned chunk are returned. add_output_segments selects the matching positions from
+  // the input's position lists.
+  void _scan_reference_segment(const ReferenceSegment& segment, PosList& pos_list) const {
+    resolve_comparator<T>(_scan_type, [&](const auto comparator) {
+      segment_iterate<T>(segment, [&](const T& value, const ChunkOffset chunk_offset) {
+        if (comparator(value, _search_value)) pos_list.push_back(chunk_offset);
+      });
+    });
+  }
+
+  const ColumnID _column_id;
+  const ScanType _scan_type;
+  const T _search_value;
+};
+
+TableScan::TableScan(const std::shared_ptr<const AbstractOperator> in, ColumnID column_id, const ScanType scan_type,
+                     const AllTypeVariant search_value)
+    : AbstractStreamingOperator(in), _column_id(column_id), _scan_type(scan_type), _search_value(search_value) {}
+
+TableScan::~TableScan() = default;
+
+ColumnID TableScan::column_id() const { return _column_id; }
+
+ScanType TableScan::scan_type() const { return _scan_type; }
+
+const AllTypeVariant& TableScan::search_value() const { return _search_value; }
+
+const std::string TableScan::name() const { return "TableScan"; }
+
+std::string TableScan::description() const {
+  std::stringstream stream;
+  stream << name() << " (#" << _column_id << " ";
+  switch (_scan_type) {
+    case ScanType::OpEquals:
+      stream << "=";
+      break;
+    case ScanType::OpNotEquals:
+      stream << "!=";
+      break;
+    case ScanType::OpLessThan:
+      stream << "<";
+      break;
+    case ScanType::OpLessThanEquals:
+      stream << "<=";
+      break;
+    case ScanType::OpGreaterThan:
+      stream << ">";
+      break;
+    case ScanType::OpGreaterThanEquals:
+      stream << ">=";
+      break;
+  }
+  stream << " " << _search_value << ")";
+  return stream.str();
+}
+
+std::shared_ptr<Table> TableScan::output_definition(const Table& input_table) const {
+  Assert(_column_id < input_table.column_count(), "TableScan: Unknown column");
+  auto output_table = std::make_shared<Table>();
+  for (ColumnID column_id{0}; column_id < input_table.column_count(); ++column_id) {
+    output_table->add_column_definition(input_table.column_name(column_id), input_table.column_type(column_id));
+  }
+  return output_table;
+}
+
+Morsel TableScan::process_morsel(const Table& input_table, Morsel morsel) const {
+  const auto impl = make_unique_by_data_type<BaseTableScanImpl, TableScanImpl>(input_table.column_type(_column_id),
+                                                                              _column_id, _scan_type, _search_value);
+
+  const auto& input_chunk = morsel.chunk;
+  auto pos_list = std::make_shared<PosList>(morsel.chunk_id);
+  if (input_chunk.size() > 0 && !impl->can_prune(input_chunk)) {
+    pos_list = impl->scan_chunk(input_chunk, morsel.chunk_id);
+  }
+
+  Chunk output_chunk;
+  add_output_segments(output_chunk, morsel, pos_list);
+  morsel.chunk = std::move(output_chunk);
+  return morsel;
+}
+
+}  // namespace opossum
@@ -5,7 +5,7 @@
 #include <string>
 #include <vector>
 
-#include "abstract_operator.hpp"
+#include "abstract_streaming_operator.hpp"
 #include "all_type_variant.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -15,7 +15,7 @@ namespace opossum {
 class BaseTableScanImpl;
 class Table;
 
-class TableScan : public AbstractOperator {
+class TableScan : public AbstractStreamingOperator {
  public:
   TableScan(const std::shared_ptr<const AbstractOperator> in, ColumnID column_id, const ScanType scan_type,
             const AllTypeVariant search_value);
@@ -26,8 +26,19 @@ class TableScan : public AbstractOperator {
   ScanType scan_type() const;
   const AllTypeVariant& search_value() const;
 
+  const std::string name() const override;
+  std::string description() const override;
+
+  std::shared_ptr<Table> output_definition(const Table& input_table) const override;
+
+  // Returns one chunk that references the tables that store the values, even if the input consists of
+  // ReferenceSegments. Columns that share a position list in the input share the matching positions in the output.
+  Morsel process_morsel(const Table& input_table, Morsel morsel) const override;
+
  protected:
-  std::shared_ptr<const Table> _on_execute() override;
+  const ColumnID _column_id;
+  const ScanType _scan_type;
+  const AllTypeVariant _search_value;
 };
 
 }  // namespace opossum
@@ -0,0 +1,158 @@
+#include "table_scan_value_id_kernel.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+#include <cstdint>
+
+#include "storage/pos_list.hpp"
+#include "utils/simd_level.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Checks the value ids in [begin, end). Because of the unsigned wrap-around, a single comparison is sufficient to check
+// both lower <= value_id and value_id < upper. The SIMD kernels use this for the values that do not fill a register.
+template <typename T>
+void scan_scalar(const T* value_ids, const size_t begin, const size_t end, const uint32_t lower,
+                 const uint32_t range_size, const bool negate, const ChunkOffset first_chunk_offset,
+                 PosList& pos_list) {
+  for (auto offset = begin; offset < end; ++offset) {
+    const auto in_range = static_cast<uint32_t>(value_ids[offset]) - lower < range_size;
+    if (in_range != negate) pos_list.push_back(static_cast<ChunkOffset>(first_chunk_offset + offset));
+  }
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+
+// movemask yields one bit per byte. For value ids wider than one byte, only the lowest bit of each lane is kept.
+template <typename T>
+constexpr uint32_t lane_bits() {
+  if constexpr (sizeof(T) == 1) return 0xFFFFFFFF;
+  if constexpr (sizeof(T) == 2) return 0x55555555;
+  return 0x11111111;
+}
+
+// Appends one position per set bit of the (thinned out) movemask
+template <typename T>
+void emit_matches(uint32_t mask, const size_t base_offset, const ChunkOffset first_chunk_offset, PosList& pos_list) {
+  while (mask) {
+    const auto lane = static_cast<size_t>(__builtin_ctz(mask)) / sizeof(T);
+    pos_list.push_back(static_cast<ChunkOffset>(first_chunk_offset + base_offset + lane));
+    mask &= mask - 1;
+  }
+}
+
+// Both SIMD kernels check (value_id - lower) <= (range_size - 1) as max(value_id - lower, range_size - 1) ==
+// range_size - 1, because SSE and AVX2 only offer signed integer comparisons. The caller guarantees that lower and
+// range_size - 1 fit into T, as neither can exceed the size of the dictionary.
+
+template <typename T>
+__attribute__((target("avx2"))) __m256i broadcast_avx2(const uint32_t value) {
+  if constexpr (sizeof(T) == 1) return _mm256_set1_epi8(static_cast<char>(value));
+  if constexpr (sizeof(T) == 2) return _mm256_set1_epi16(static_cast<int16_t>(value));
+  return _mm256_set1_epi32(static_cast<int32_t>(value));
+}
+
+template <typename T>
+__attribute__((target("avx2"))) __m256i in_range_avx2(const __m256i values, const __m256i lower, const __m256i max) {
+  if constexpr (sizeof(T) == 1) return _mm256_cmpeq_epi8(_mm256_max_epu8(_mm256_sub_epi8(values, lower), max), max);
+  if constexpr (sizeof(T) == 2) {
+    return _mm256_cmpeq_epi16(_mm256_max_epu16(_mm256_sub_epi16(values, lower), max), max);
+  }
+  return _mm256_cmpeq_epi32(_mm256_max_epu32(_mm256_sub_epi32(values, lower), max), max);
+}
+
+template <typename T>
+__attribute__((target("avx2"))) void scan_avx2(const T* value_ids, const size_t size, const uint32_t lower,
+                                                const uint32_t range_size, const bool negate,
+                                                const ChunkOffset first_chunk_offset, PosList& pos_list) {
+  constexpr auto values_per_register = sizeof(__m256i) / sizeof(T);
+  const auto lower_vector = broadcast_avx2<T>(lower);
+  const auto max_vector = broadcast_avx2<T>(range_size - 1);
+  const auto negate_mask = negate ? uint32_t{0xFFFFFFFF} : uint32_t{0};
+
+  auto offset = size_t{0};
+  for (; offset + values_per_register <= size; offset += values_per_register) {
+    const auto values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(value_ids + offset));
+    const auto matches = in_range_avx2<T>(values, lower_vector, max_vector);
+    const auto mask = (static_cast<uint32_t>(_mm256_movemask_epi8(matches)) ^ negate_mask) & lane_bits<T>();
+    emit_matches<T>(mask, offset, first_chunk_offset, pos_list);
+  }
+  scan_scalar(value_ids, offset, size, lower, range_size, negate, first_chunk_offset, pos_list);
+}
+
+template <typename T>
+__attribute__((target("sse4.1"))) __m128i broadcast_sse41(const uint32_t value) {
+  if constexpr (sizeof(T) == 1) return _mm_set1_epi8(static_cast<char>(value));
+  if constexpr (sizeof(T) == 2) return _mm_set1_epi16(static_cast<int16_t>(value));
+  return _mm_set1_epi32(static_cast<int32_t>(value));
+}
+
+template <typename T>
+__attribute__((target("sse4.1"))) __m128i in_range_sse41(const __m128i values, const __m128i lower, const __m128i max) {
+  if constexpr (sizeof(T) == 1) return _mm_cmpeq_epi8(_mm_max_epu8(_mm_sub_epi8(values, lower), max), max);
+  if constexpr (sizeof(T) == 2) return _mm_cmpeq_epi16(_mm_max_epu16(_mm_sub_epi16(values, lower), max), max);
+  return _mm_cmpeq_epi32(_mm_max_epu32(_mm_sub_epi32(values, lower), max), max);
+}
+
+template <typename T>
+__attribute__((target("sse4.1"))) void scan_sse41(const T* value_ids, const size_t size, const uint32_t lower,
+                                                   const uint32_t range_size, const bool negate,
+                                                   const ChunkOffset first_chunk_offset, PosList& pos_list) {
+  constexpr auto values_per_register = sizeof(__m128i) / sizeof(T);
+  const auto lower_vector = broadcast_sse41<T>(lower);
+  const auto max_vector = broadcast_sse41<T>(range_size - 1);
+  const auto negate_mask = negate ? uint32_t{0xFFFF} : uint32_t{0};
+
+  auto offset = size_t{0};
+  for (; offset + values_per_register <= size; offset += values_per_register) {
+    const auto values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(value_ids + offset));
+    const auto matches = in_range_sse41<T>(values, lower_vector, max_vector);
+    const auto mask = (static_cast<uint32_t>(_mm_movemask_epi8(matches)) ^ negate_mask) & lane_bits<T>();
+    emit_matches<T>(mask, offset, first_chunk_offset, pos_list);
+  }
+  scan_scalar(value_ids, offset, size, lower, range_size, negate, first_chunk_offset, pos_list);
+}
+
+#endif
+
+}  // namespace
+
+template <typename T>
+void scan_value_id_range(const T* value_ids, const size_t size, const ValueID lower, const ValueID upper,
+                         const bool negate, const ChunkOffset first_chunk_offset, PosList& pos_list) {
+  // An empty range matches either no value id at all or, if negated, every value id
+  if (upper <= lower) {
+    if (negate) pos_list.push_back_range(first_chunk_offset, static_cast<ChunkOffset>(first_chunk_offset + size));
+    return;
+  }
+
+  const uint32_t lower_value_id = lower;
+  const uint32_t range_size = upper - lower;
+
+  switch (simd_level()) {
+#if defined(__x86_64__) || defined(__i386__)
+    case SimdLevel::AVX2:
+      scan_avx2(value_ids, size, lower_value_id, range_size, negate, first_chunk_offset, pos_list);
+      return;
+    case SimdLevel::SSE41:
+      scan_sse41(value_ids, size, lower_value_id, range_size, negate, first_chunk_offset, pos_list);
+      return;
+#endif
+    default:
+      scan_scalar(value_ids, size_t{0}, size, lower_value_id, range_size, negate, first_chunk_offset, pos_list);
+  }
+}
+
+// Explicitly instantiate the kernel for the value id widths used by FixedSizeAttributeVector
+template void scan_value_id_range<uint8_t>(const uint8_t*, const size_t, const ValueID, const ValueID, const bool,
+                                           const ChunkOffset, PosList&);
+template void scan_value_id_range<uint16_t>(const uint16_t*, const size_t, const ValueID, const ValueID, const bool,
+                                            const ChunkOffset, PosList&);
+template void scan_value_id_range<uint32_t>(const uint32_t*, const size_t, const ValueID, const ValueID, const bool,
+                                            const ChunkOffset, PosList&);
+
+}  // namespace opossum
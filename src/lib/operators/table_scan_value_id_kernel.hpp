@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Scans value ids of type T (uint8_t, uint16_t, or uint32_t), e.g., those of a FixedSizeAttributeVector<T>, and appends
+// the positions of all value ids within the half-open range [lower, upper) to pos_list, which has to reference the
+// scanned chunk only (see PosList). If negate is set, the positions of all value ids outside of that range are
+// appended instead. The value ids are expected to start at first_chunk_offset within the chunk, which allows scanning
+// a chunk block by block.
+//
+// Because the dictionaries are sorted, every ScanType can be expressed as such a (possibly negated) value id range,
+// so that the scan never has to decode the actual values. Depending on the instruction sets supported by the CPU
+// that executes the scan, an AVX2, an SSE4.1, or a scalar kernel is used. This is decided once at runtime.
+template <typename T>
+void scan_value_id_range(const T* value_ids, const size_t size, const ValueID lower, const ValueID upper,
+                         const bool negate, const ChunkOffset first_chunk_offset, PosList& pos_list);
+
+}  // namespace opossum
@@ -0,0 +1,127 @@
+#include "worker_pool.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+WorkerPool& WorkerPool::get() {
+  static const auto worker_count = std::max(size_t{1}, static_cast<size_t>(std::thread::hardware_concurrency()));
+  static WorkerPool instance{worker_count, 4 * worker_count};
+  return instance;
+}
+
+WorkerPool::WorkerPool(const size_t worker_count, const size_t max_queue_size) : _max_queue_size(max_queue_size) {
+  Assert(worker_count > 0, "A WorkerPool needs at least one worker.");
+  Assert(max_queue_size > 0, "The queue of a WorkerPool has to hold at least one job.");
+
+  _workers.reserve(worker_count);
+  for (auto worker_index = size_t{0}; worker_index < worker_count; ++worker_index) {
+    _workers.emplace_back(&WorkerPool::_work, this);
+  }
+}
+
+WorkerPool::~WorkerPool() {
+  {
+    std::lock_guard<std::mutex> lock(_queue_mutex);
+    _shutdown = true;
+  }
+  _queue_not_empty.notify_all();
+
+  // The workers finish all queued jobs before they exit
+  for (auto& worker : _workers) worker.join();
+}
+
+size_t WorkerPool::worker_count() const { return _workers.size(); }
+
+void WorkerPool::schedule(std::function<void()> job) {
+  std::unique_lock<std::mutex> lock(_queue_mutex);
+  while (_queue.size() >= _max_queue_size) {
+    lock.unlock();
+    _try_run_queued_job();
+    lock.lock();
+  }
+  _queue.push_back(std::move(job));
+  lock.unlock();
+
+  _queue_not_empty.notify_one();
+}
+
+void WorkerPool::run_and_wait(const std::vector<std::function<void()>>& jobs) {
+  // Tracks the jobs of this call. It is shared with the jobs because the last job might still hold the mutex when the
+  // waiting thread returns.
+  struct JobGroup {
+    std::mutex mutex;
+    std::condition_variable all_done;
+    size_t remaining_jobs;
+    std::exception_ptr exception;
+  };
+
+  auto job_group = std::make_shared<JobGroup>();
+  job_group->remaining_jobs = jobs.size();
+
+  for (const auto& job : jobs) {
+    schedule([job_group, &job]() {
+      std::exception_ptr exception;
+      try {
+        job();
+      } catch (...) {
+        exception = std::current_exception();
+      }
+
+      std::lock_guard<std::mutex> lock(job_group->mutex);
+      if (exception && !job_group->exception) job_group->exception = exception;
+      if (--job_group->remaining_jobs == 0) job_group->all_done.notify_all();
+    });
+  }
+
+  // Instead of blocking, help with queued jobs. Once the queue is empty, all remaining jobs of this group are being
+  // executed by other threads and we only have to wait for them.
+  while (true) {
+    {
+      std::lock_guard<std::mutex> lock(job_group->mutex);
+      if (job_group->remaining_jobs == 0) break;
+    }
+    if (_try_run_queued_job()) continue;
+
+    std::unique_lock<std::mutex> lock(job_group->mutex);
+    job_group->all_done.wait(lock, [&]() { return job_group->remaining_jobs == 0; });
+  }
+
+  if (job_group->exception) std::rethrow_exception(job_group->exception);
+}
+
+bool WorkerPool::_try_run_queued_job() {
+  std::function<void()> job;
+  {
+    std::lock_guard<std::mutex> lock(_queue_mutex);
+    if (_queue.empty()) return false;
+    job = std::move(_queue.front());
+    _queue.pop_front();
+  }
+  job();
+  return true;
+}
+
+void WorkerPool::_work() {
+  while (true) {
+    std::function<void()> job;
+    {
+      std::unique_lock<std::mutex> lock(_queue_mutex);
+      _queue_not_empty.wait(lock, [&]() { return _shutdown || !_queue.empty(); });
+      // The queue can only be empty here if the pool is shutting down
+      if (_queue.empty()) return;
+      job = std::move(_queue.front());
+      _queue.pop_front();
+    }
+    job();
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// The WorkerPool is a fixed-size set of worker threads that is shared across the process. Jobs are put into a bounded
+// queue from which the workers take them. This avoids the cost of creating a thread for every parallel task, e.g.,
+// for every segment that is compressed.
+//
+// Threads that wait for jobs (run_and_wait) or that find the queue full (schedule) execute queued jobs themselves.
+// Because of this, jobs may use the pool themselves without deadlocking it.
+class WorkerPool : private Noncopyable {
+ public:
+  // returns the process-wide pool, which has one worker per hardware thread
+  static WorkerPool& get();
+
+  // creates a pool with the given number of workers. The queue holds at most max_queue_size jobs.
+  explicit WorkerPool(const size_t worker_count, const size_t max_queue_size);
+
+  ~WorkerPool();
+
+  // returns the number of worker threads
+  size_t worker_count() const;
+
+  // puts a job into the queue and returns without waiting for it. If the queue is full, the calling thread executes
+  // queued jobs until there is space. Exceptions thrown by the job terminate the program.
+  void schedule(std::function<void()> job);
+
+  // executes all jobs on the pool and returns once all of them have finished. If one of the jobs threw an exception,
+  // the first exception is rethrown.
+  void run_and_wait(const std::vector<std::function<void()>>& jobs);
+
+ protected:
+  // takes one job from the queue and executes it. Returns false if the queue was empty.
+  bool _try_run_queued_job();
+
+  void _work();
+
+  std::vector<std::thread> _workers;
+  const size_t _max_queue_size;
+
+  std::deque<std::function<void()>> _queue;
+  std::mutex _queue_mutex;
+  std::condition_variable _queue_not_empty;
+  bool _shutdown = false;
+};
+
+}  // namespace opossum
@@ -4,6 +4,7 @@
 #include <string>
 
 #include "all_type_variant.hpp"
+#include "segment_statistics.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -29,7 +30,12 @@ class BaseSegment : private Noncopyable {
   // returns the number of values
   virtual size_t size() const = 0;
 
-  // returns the calculated memory usage
+  // Returns the bytes of the segment object and of the memory it owns, including unused capacity and the heap buffers
+  // of strings (see utils/memory_usage.hpp). Memory that is shared with other segments is counted by each of them.
   virtual size_t estimate_memory_usage() const = 0;
+
+  // Computes the zone map of the segment. Returns nullptr if the segment is empty or cannot provide one, e.g., because
+  // it only references values of other segments.
+  virtual std::shared_ptr<const SegmentStatistics> compute_statistics() const = 0;
 };
 }  // namespace opossum
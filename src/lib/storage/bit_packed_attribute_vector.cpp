@@ -0,0 +1,125 @@
+#include "bit_packed_attribute_vector.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+#include "utils/memory_usage.hpp"
+#include "utils/simd_level.hpp"
+
+namespace opossum {
+
+namespace {
+
+#if defined(__x86_64__) || defined(__i386__)
+
+// Within a block of eight value ids, which occupies exactly bit_width bytes, the byte offset and the shift of every
+// value id only depend on the bit width. Each block is thus unpacked using one gather, one shift, and one mask. As a
+// gather reads four bytes per value id, this works for bit widths of up to 25 bits (shift of up to 7 bits + 25 bits).
+__attribute__((target("avx2"))) void decode_blocks_avx2(const char* first_block, const size_t block_count,
+                                                         const uint8_t bit_width, const uint32_t mask,
+                                                         uint32_t* output) {
+  const auto offsets = _mm256_setr_epi32(0, bit_width / 8, 2 * bit_width / 8, 3 * bit_width / 8, 4 * bit_width / 8,
+                                         5 * bit_width / 8, 6 * bit_width / 8, 7 * bit_width / 8);
+  const auto shifts = _mm256_setr_epi32(0, bit_width % 8, 2 * bit_width % 8, 3 * bit_width % 8, 4 * bit_width % 8,
+                                        5 * bit_width % 8, 6 * bit_width % 8, 7 * bit_width % 8);
+  const auto mask_vector = _mm256_set1_epi32(static_cast<int32_t>(mask));
+
+  for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+    const auto block = reinterpret_cast<const int*>(first_block + block_index * bit_width);
+    const auto packed_values = _mm256_i32gather_epi32(block, offsets, 1);
+    const auto values = _mm256_and_si256(_mm256_srlv_epi32(packed_values, shifts), mask_vector);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + block_index * 8), values);
+  }
+}
+
+#endif
+
+}  // namespace
+
+BitPackedAttributeVector::BitPackedAttributeVector(const size_t size, const uint8_t bit_width,
+                                                   const PolymorphicAllocator<uint64_t>& allocator)
+    : _size(size),
+      _bit_width(bit_width),
+      _mask((uint64_t{1} << bit_width) - 1),
+      _words(pmr_vector<uint64_t>((size * bit_width + 63) / 64 + 1, allocator)) {
+  DebugAssert(bit_width >= 1 && bit_width <= 32, "The bit width has to be between 1 and 32.");
+}
+
+BitPackedAttributeVector::BitPackedAttributeVector(const size_t size, const uint8_t bit_width,
+                                                   SegmentBuffer<uint64_t>&& words)
+    : _size(size), _bit_width(bit_width), _mask((uint64_t{1} << bit_width) - 1), _words(std::move(words)) {
+  DebugAssert(bit_width >= 1 && bit_width <= 32, "The bit width has to be between 1 and 32.");
+  Assert(_words.size() == (size * bit_width + 63) / 64 + 1, "The number of words does not match size and bit width.");
+}
+
+uint8_t BitPackedAttributeVector::required_bit_width(const size_t dictionary_size) {
+  // The largest value id is dictionary_size - 1. Even a dictionary with a single entry needs one bit.
+  if (dictionary_size <= 2) return 1;
+  return static_cast<uint8_t>(64 - __builtin_clzll(dictionary_size - 1));
+}
+
+ValueID BitPackedAttributeVector::get(const size_t i) const {
+  DebugAssert(i < _size, "There exists no value id with the given position.");
+  const auto bit_offset = i * _bit_width;
+
+  // Reading eight bytes starting at the value id's first byte covers the entire value id (at most 7 + 32 bits)
+  uint64_t word;
+  std::memcpy(&word, reinterpret_cast<const char*>(_words.data()) + bit_offset / 8, sizeof(word));
+  return ValueID{static_cast<ValueID::base_type>((word >> (bit_offset % 8)) & _mask)};
+}
+
+void BitPackedAttributeVector::set(const size_t i, const ValueID value_id) {
+  DebugAssert(i < _size, "There exists no value id with the given position.");
+  DebugAssert(static_cast<uint64_t>(value_id) <= _mask, "The value id does not fit into the bit width.");
+  const auto bit_offset = i * _bit_width;
+  const auto shift = bit_offset % 8;
+  auto bytes = reinterpret_cast<char*>(_words.mutable_data()) + bit_offset / 8;
+
+  uint64_t word;
+  std::memcpy(&word, bytes, sizeof(word));
+  word = (word & ~(_mask << shift)) | (static_cast<uint64_t>(value_id) << shift);
+  std::memcpy(bytes, &word, sizeof(word));
+}
+
+size_t BitPackedAttributeVector::size() const { return _size; }
+
+AttributeVectorWidth BitPackedAttributeVector::width() const {
+  if (_bit_width <= 8) return AttributeVectorWidth{1};
+  if (_bit_width <= 16) return AttributeVectorWidth{2};
+  return AttributeVectorWidth{4};
+}
+
+uint8_t BitPackedAttributeVector::bit_width() const { return _bit_width; }
+
+size_t BitPackedAttributeVector::estimate_memory_usage() const { return sizeof(*this) + heap_memory_usage(_words); }
+
+const SegmentBuffer<uint64_t>& BitPackedAttributeVector::words() const { return _words; }
+
+void BitPackedAttributeVector::decode(const size_t first_index, const size_t count, uint32_t* output) const {
+  DebugAssert(first_index + count <= _size, "Cannot decode value ids beyond the end of the attribute vector.");
+  const auto end_index = first_index + count;
+  auto index = first_index;
+
+#if defined(__x86_64__) || defined(__i386__)
+  if (_bit_width <= 25 && simd_level() == SimdLevel::AVX2) {
+    // Blocks start at value ids whose position is a multiple of eight, i.e., at a byte boundary
+    for (; index < end_index && index % 8 != 0; ++index) *output++ = get(index);
+
+    const auto block_count = (end_index - index) / 8;
+    const auto first_block = reinterpret_cast<const char*>(_words.data()) + index * _bit_width / 8;
+    decode_blocks_avx2(first_block, block_count, _bit_width, static_cast<uint32_t>(_mask), output);
+    index += block_count * 8;
+    output += block_count * 8;
+  }
+#endif
+
+  for (; index < end_index; ++index) *output++ = get(index);
+}
+
+}  // namespace opossum
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "base_attribute_vector.hpp"
+#include "segment_buffer.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Attribute vector that stores each value id using only as many bits as the largest value id needs (1 to 32 bits).
+// The value ids are packed back to back, so a value id may span two 64-bit words. This assumes a little-endian CPU.
+class BitPackedAttributeVector final : public BaseAttributeVector {
+ public:
+  /**
+   * Creates a bit-packed attribute vector in which all value ids are zero.
+   *
+   * @param size is the number of value ids that the attribute vector holds
+   * @param bit_width is the number of bits used for each value id (1 to 32)
+   */
+  BitPackedAttributeVector(const size_t size, const uint8_t bit_width,
+                           const PolymorphicAllocator<uint64_t>& allocator = {});
+
+  // creates a bit-packed attribute vector from words that have been packed before, e.g., when loading a table from a
+  // file. The words have to include the padding word (see _words).
+  BitPackedAttributeVector(const size_t size, const uint8_t bit_width, SegmentBuffer<uint64_t>&& words);
+
+  // returns the smallest bit width that can represent all value ids of a dictionary with the given size
+  static uint8_t required_bit_width(const size_t dictionary_size);
+
+  // returns the value id at a given position
+  ValueID get(const size_t i) const override;
+
+  // sets the value id at a given position
+  void set(const size_t i, const ValueID value_id) override;
+
+  // returns the number of values
+  size_t size() const override;
+
+  // returns the width in bytes of the smallest unsigned integer type that holds the value ids once they are decoded
+  AttributeVectorWidth width() const override;
+
+  // returns the number of bits used for each value id
+  uint8_t bit_width() const;
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const override;
+
+  // returns the packed words, including the padding word
+  const SegmentBuffer<uint64_t>& words() const;
+
+  // Decodes count value ids starting at position first_index into output. Use this instead of get() when accessing
+  // many consecutive value ids. If the CPU supports AVX2, blocks of eight value ids are unpacked at once.
+  void decode(const size_t first_index, const size_t count, uint32_t* output) const;
+
+ protected:
+  const size_t _size;
+  const uint8_t _bit_width;
+  const uint64_t _mask;
+
+  // Holds one word more than necessary so that eight bytes can be read at the position of every value id
+  SegmentBuffer<uint64_t> _words;
+};
+
+}  // namespace opossum
@@ -1,38 +1,164 @@
+#include <algorithm>
+#include <atomic>
 #include <iomanip>
 #include <iterator>
 #include <limits>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "base_segment.hpp"
 #include "chunk.hpp"
+#include "reference_segment.hpp"
+#include "value_segment.hpp"
 
 #include "utils/assert.hpp"
+#include "utils/memory_usage.hpp"
 
 namespace opossum {
 
-void Chunk::add_segment(std::shared_ptr<BaseSegment> segment) { _columns.push_back(segment); }
+namespace {
+
+// Returns the number of values held by an AllTypeVector
+const auto value_vector_size = [](const auto& values) { return values.size(); };
+
+}  // namespace
+
+Chunk::Chunk(const ChunkOffset capacity) : _concurrent_appends(std::make_shared<ConcurrentAppends>(capacity)) {}
+
+void Chunk::add_segment(std::shared_ptr<BaseSegment> segment, std::shared_ptr<const SegmentStatistics> statistics) {
+  _columns.push_back(segment);
+  _statistics.push_back(std::move(statistics));
+}
 
 void Chunk::append(const std::vector<AllTypeVariant>& values) {
+  Assert(!is_preallocated(), "Rows are appended to preallocated chunks with Table::append_concurrently.");
   DebugAssert(values.size() == column_count(),
               "The number of passed arguments doesn't match the number of columns in the chunk.");
   for (auto value_index = ColumnID{0}; value_index < ColumnID{values.size()}; ++value_index)
     _columns[value_index]->append(values[value_index]);
+  std::fill(_statistics.begin(), _statistics.end(), nullptr);
+}
+
+void Chunk::append_columns(std::vector<AllTypeVector>&& columns) {
+  Assert(!is_preallocated(), "Rows are appended to preallocated chunks with Table::append_concurrently.");
+  Assert(columns.size() == column_count(),
+         "The number of passed columns doesn't match the number of columns in the chunk.");
+
+  // Check all columns before appending anything, so that a failed append does not leave the chunk inconsistent
+  const auto value_count = columns.empty() ? size_t{0} : boost::apply_visitor(value_vector_size, columns[0]);
+  for (auto column_id = ColumnID{0}; column_id < column_count(); ++column_id) {
+    Assert(boost::apply_visitor(value_vector_size, columns[column_id]) == value_count,
+           "All columns have to hold the same number of values.");
+    boost::apply_visitor(
+        [&](const auto& values) {
+          using Type = typename std::decay_t<decltype(values)>::value_type;
+          Assert(std::dynamic_pointer_cast<ValueSegment<Type>>(_columns[column_id]),
+                 "Values can only be appended to ValueSegments of the same type.");
+        },
+        columns[column_id]);
+  }
+
+  for (auto column_id = ColumnID{0}; column_id < column_count(); ++column_id) {
+    boost::apply_visitor(
+        [&](auto& values) {
+          using Type = typename std::decay_t<decltype(values)>::value_type;
+          std::static_pointer_cast<ValueSegment<Type>>(_columns[column_id])->append_values(std::move(values));
+        },
+        columns[column_id]);
+  }
+  std::fill(_statistics.begin(), _statistics.end(), nullptr);
 }
 
 std::shared_ptr<BaseSegment> Chunk::get_segment(ColumnID column_id) const {
   DebugAssert(column_id < column_count(), "The given column_id is outside of the segment's columns.");
-  return _columns[column_id];
+  return std::atomic_load(&_columns[column_id]);
+}
+
+void Chunk::replace_segment(ColumnID column_id, std::shared_ptr<BaseSegment> segment) {
+  DebugAssert(column_id < column_count(), "The given column_id is outside of the segment's columns.");
+  DebugAssert(segment->size() == size(), "The new segment has to hold as many values as the old one.");
+  std::atomic_store(&_columns[column_id], std::move(segment));
+}
+
+void Chunk::compute_statistics() {
+  // The chunk may already be visible to scans (e.g., a preallocated chunk that just became full), which read the zone
+  // maps concurrently. Like the segments, they are therefore swapped atomically.
+  for (auto column_id = ColumnID{0}; column_id < column_count(); ++column_id) {
+    std::atomic_store(&_statistics[column_id], get_segment(column_id)->compute_statistics());
+  }
+}
+
+std::shared_ptr<const SegmentStatistics> Chunk::statistics(ColumnID column_id) const {
+  DebugAssert(column_id < column_count(), "The given column_id is outside of the segment's columns.");
+  return std::atomic_load(&_statistics[column_id]);
+}
+
+size_t Chunk::estimate_memory_usage() const {
+  std::unordered_set<const PosList*> counted_pos_lists;
+  return estimate_memory_usage(counted_pos_lists);
+}
+
+size_t Chunk::estimate_memory_usage(std::unordered_set<const PosList*>& counted_pos_lists) const {
+  auto bytes = sizeof(*this) + heap_memory_usage(_columns) + heap_memory_usage(_statistics);
+  for (auto column_id = ColumnID{0}; column_id < column_count(); ++column_id) {
+    const auto segment = get_segment(column_id);
+    bytes += SHARED_PTR_CONTROL_BLOCK_SIZE;
+    // The ReferenceSegments of an operator's output chunk usually share one position list
+    const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment);
+    if (reference_segment && !counted_pos_lists.insert(reference_segment->pos_list().get()).second) {
+      bytes += reference_segment->estimate_memory_usage_without_pos_list();
+    } else {
+      bytes += segment->estimate_memory_usage();
+    }
+    if (const auto statistics = this->statistics(column_id)) {
+      bytes += SHARED_PTR_CONTROL_BLOCK_SIZE + sizeof(SegmentStatistics) + heap_memory_usage(statistics->min) +
+               heap_memory_usage(statistics->max);
+    }
+  }
+  if (_concurrent_appends) bytes += SHARED_PTR_CONTROL_BLOCK_SIZE + sizeof(ConcurrentAppends);
+  return bytes;
 }
 
 uint16_t Chunk::column_count() const { return _columns.size(); }
 
 uint32_t Chunk::size() const {
+  if (_concurrent_appends) return _concurrent_appends->published_size.load(std::memory_order_acquire);
   if (_columns.empty()) return 0;
-  return _columns[0]->size();
+  return get_segment(ColumnID{0})->size();
+}
+
+bool Chunk::is_preallocated() const { return _concurrent_appends != nullptr; }
+
+ChunkOffset Chunk::capacity() const {
+  DebugAssert(is_preallocated(), "Only preallocated chunks have a capacity.");
+  return _concurrent_appends->capacity;
+}
+
+std::optional<ChunkOffset> Chunk::reserve_row() {
+  if (!_concurrent_appends) return std::nullopt;
+  const auto row = _concurrent_appends->reserved_size.fetch_add(1);
+  if (row >= _concurrent_appends->capacity) return std::nullopt;
+  return static_cast<ChunkOffset>(row);
+}
+
+void Chunk::publish_row(const ChunkOffset chunk_offset) {
+  DebugAssert(is_preallocated(), "Only rows of preallocated chunks are published.");
+  auto& published_size = _concurrent_appends->published_size;
+  while (published_size.load(std::memory_order_acquire) != chunk_offset) std::this_thread::yield();
+  // The release store makes the values of the row visible to all threads that read the new size
+  published_size.store(chunk_offset + 1, std::memory_order_release);
+}
+
+std::shared_ptr<const std::atomic<ChunkOffset>> Chunk::published_size() const {
+  DebugAssert(is_preallocated(), "Only preallocated chunks publish their size.");
+  // The pointer shares the ownership of the whole struct, so it stays valid even if the chunk is gone
+  return std::shared_ptr<const std::atomic<ChunkOffset>>(_concurrent_appends, &_concurrent_appends->published_size);
 }
 
 }  // namespace opossum
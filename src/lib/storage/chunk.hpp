@@ -5,16 +5,20 @@
 
 #include <atomic>
 #include <memory>
+#include <optional>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "all_type_variant.hpp"
+#include "segment_statistics.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
 class BaseIndex;
 class BaseSegment;
+class PosList;
 
 // A chunk is a horizontal partition of a table.
 // For each column in the table, it holds one segment. The segments across all chunks constitute the column.
@@ -24,29 +28,91 @@ class Chunk : private Noncopyable {
  public:
   Chunk() = default;
 
+  // Creates a chunk for concurrent appends of up to capacity rows (see Table::append_concurrently). Its segments have
+  // to be ValueSegments with capacity preallocated slots that share published_size().
+  explicit Chunk(const ChunkOffset capacity);
+
   // we need to explicitly set the move constructor to default when
   // we overwrite the copy constructor
   Chunk(Chunk&&) = default;
   Chunk& operator=(Chunk&&) = default;
 
-  // adds a segment to the "right" of the chunk
-  void add_segment(std::shared_ptr<BaseSegment> segment);
+  // adds a segment to the "right" of the chunk. If the segment is shared with another chunk, its zone map can be
+  // passed along.
+  void add_segment(std::shared_ptr<BaseSegment> segment,
+                   std::shared_ptr<const SegmentStatistics> statistics = nullptr);
 
   // returns the number of columns (cannot exceed ColumnID (uint16_t))
   uint16_t column_count() const;
 
   // returns the number of rows (cannot exceed ChunkOffset (uint32_t))
+  // for preallocated chunks, this is the number of published rows
   uint32_t size() const;
 
+  // returns whether the chunk was created for concurrent appends
+  bool is_preallocated() const;
+
+  // returns the number of rows that a preallocated chunk can hold
+  ChunkOffset capacity() const;
+
+  // Atomically reserves the next free row of a preallocated chunk. Returns std::nullopt if the chunk is full or not
+  // preallocated. The values of the row are then written into the slots of the segments.
+  std::optional<ChunkOffset> reserve_row();
+
+  // Makes a reserved row visible to readers once all its values are written. Rows are published in the order in which
+  // they were reserved, so this waits until all rows before it are published.
+  void publish_row(const ChunkOffset chunk_offset);
+
+  // returns the number of published rows, shared with the preallocated segments
+  std::shared_ptr<const std::atomic<ChunkOffset>> published_size() const;
+
   // adds a new row, given as a list of values, to the chunk
   // note this is slow and not thread-safe and should be used for testing purposes only
   void append(const std::vector<AllTypeVariant>& values);
 
+  // Appends one vector of values per column at once. All vectors have to hold the same number of values, and their
+  // types have to match the types of the chunk's ValueSegments. The values are moved into the segments.
+  void append_columns(std::vector<AllTypeVector>&& columns);
+
   // Returns the segment at a given position
   std::shared_ptr<BaseSegment> get_segment(ColumnID column_id) const;
 
+  // Replaces the segment at a given position with one that holds the same values, e.g., with a compressed version of
+  // it. This is safe while other threads call get_segment: they either get the old or the new segment, and the old
+  // segment stays alive as long as they hold it.
+  void replace_segment(ColumnID column_id, std::shared_ptr<BaseSegment> segment);
+
+  // Computes the zone maps of all segments, e.g., once the chunk is full or has been compressed
+  void compute_statistics();
+
+  // Returns the zone map of the segment at a given position, or nullptr if it is unknown. Appending to the chunk
+  // discards the zone maps, as they would be outdated.
+  std::shared_ptr<const SegmentStatistics> statistics(ColumnID column_id) const;
+
+  // Returns the bytes of the chunk including its segments and zone maps (see BaseSegment::estimate_memory_usage). A
+  // segment that is shared with other chunks, e.g., by a Projection, is counted by each of them. A position list that
+  // is shared by several ReferenceSegments of the chunk is counted once.
+  size_t estimate_memory_usage() const;
+
+  // Same as above, but position lists that are in counted_pos_lists are not counted again. The position lists of the
+  // chunk are added to it, so that a table can count the position lists shared by its chunks once.
+  size_t estimate_memory_usage(std::unordered_set<const PosList*>& counted_pos_lists) const;
+
  protected:
+  struct ConcurrentAppends {
+    explicit ConcurrentAppends(const ChunkOffset init_capacity) : capacity(init_capacity) {}
+
+    const ChunkOffset capacity;
+    // may exceed the capacity when threads try to reserve rows of a full chunk
+    std::atomic<uint64_t> reserved_size{0};
+    std::atomic<ChunkOffset> published_size{0};
+  };
+
   std::vector<std::shared_ptr<BaseSegment>> _columns;
+  std::vector<std::shared_ptr<const SegmentStatistics>> _statistics;
+
+  // only set for preallocated chunks
+  std::shared_ptr<ConcurrentAppends> _concurrent_appends;
 };
 
 }  // namespace opossum
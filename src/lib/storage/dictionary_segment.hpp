@@ -3,17 +3,25 @@
 #include <type_cast.hpp>
 
 #include <algorithm>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "all_type_variant.hpp"
 #include "base_attribute_vector.hpp"
+#include "bit_packed_attribute_vector.hpp"
 #include "fixed_size_attribute_vector.hpp"
+#include "front_coded_dictionary.hpp"
 #include "resolve_type.hpp"
+#include "segment_arena.hpp"
+#include "segment_buffer.hpp"
+#include "segment_iterate.hpp"
 #include "types.hpp"
+#include "utils/memory_usage.hpp"
 
 namespace opossum {
 
@@ -24,44 +32,81 @@ class BaseSegment;
 // types (uint8_t, uint16_t) since after a down-cast INVALID_VALUE_ID will look like their numeric_limit::max()
 constexpr ValueID INVALID_VALUE_ID{std::numeric_limits<ValueID::base_type>::max()};
 
-// Dictionary is a specific segment type that stores all its values in a vector
+// Dictionary is a specific segment type that stores all its distinct values in a sorted dictionary and, for each
+// position, the index of its value in the dictionary (the value id). Strings are stored in a FrontCodedDictionary, all
+// other types in a SegmentBuffer.
 template <typename T>
 class DictionarySegment : public BaseSegment {
  public:
+  using Dictionary = std::conditional_t<std::is_same_v<T, std::string>, FrontCodedDictionary, SegmentBuffer<T>>;
+
+  // all values of the dictionary, see decoded_dictionary()
+  using DecodedDictionary = std::conditional_t<std::is_same_v<T, std::string>, pmr_vector<T>, SegmentBuffer<T>>;
+
   /**
    * Creates a Dictionary segment from a given value segment.
+   *
+   * @param attribute_vector_encoding determines whether the value ids are stored in a FixedSizeAttributeVector or in a
+   *                                  BitPackedAttributeVector
+   * @param allocator allocates the dictionary and the attribute vector, which share the ownership of its arena
    */
-  explicit DictionarySegment(const std::shared_ptr<BaseSegment>& base_segment) {
-    _dictionary = std::make_shared<std::vector<T>>(base_segment->size());
-
-    // Since we haven't access to the underlying data structure of the BaseSegment base_segment, we use
-    // the [] operator to manually create a copy of the base_segment's values
-    for (size_t value_index = (ChunkOffset)0; value_index < base_segment->size(); value_index++) {
-      (*_dictionary)[value_index] = type_cast<T>((*base_segment)[value_index]);
-    }
+  explicit DictionarySegment(
+      const std::shared_ptr<BaseSegment>& base_segment,
+      const AttributeVectorEncoding attribute_vector_encoding = AttributeVectorEncoding::FixedSize,
+      const ArenaAllocator<T>& allocator = {})
+      : _arena(allocator.arena()) {
+    const auto resource = allocator.resource();
+    auto values = std::vector<T>{};
+    values.reserve(base_segment->size());
+
+    // Copy the base_segment's values without boxing each of them into an AllTypeVariant
+    segment_iterate<T>(*base_segment, [&](const T& value, const ChunkOffset) { values.push_back(value); });
 
     // The copied values are sorted and duplicates are removed
-    std::sort(_dictionary->begin(), _dictionary->end());
-    _dictionary->erase(std::unique(_dictionary->begin(), _dictionary->end()), _dictionary->end());
+    std::sort(values.begin(), values.end());
+    values.erase(std::unique(values.begin(), values.end()), values.end());
 
-    // Determine the size of the to-be-created FixedSizeAttributeVector based on the amount of distinct values
+    // Determine the size of the to-be-created attribute vector based on the amount of distinct values
     // (i.e. the length/size of the dictionary)
-    if (_dictionary->size() < std::numeric_limits<uint8_t>::max()) {
-      _attribute_vector = std::make_shared<FixedSizeAttributeVector<uint8_t>>(base_segment->size());
-    } else if (_dictionary->size() < std::numeric_limits<uint16_t>::max()) {
-      _attribute_vector = std::make_shared<FixedSizeAttributeVector<uint16_t>>(base_segment->size());
+    if (attribute_vector_encoding == AttributeVectorEncoding::BitPacked) {
+      _attribute_vector = std::allocate_shared<BitPackedAttributeVector>(
+          allocator, base_segment->size(), BitPackedAttributeVector::required_bit_width(values.size()), resource);
+    } else if (values.size() < std::numeric_limits<uint8_t>::max()) {
+      _attribute_vector =
+          std::allocate_shared<FixedSizeAttributeVector<uint8_t>>(allocator, base_segment->size(), resource);
+    } else if (values.size() < std::numeric_limits<uint16_t>::max()) {
+      _attribute_vector =
+          std::allocate_shared<FixedSizeAttributeVector<uint16_t>>(allocator, base_segment->size(), resource);
     } else {
-      _attribute_vector = std::make_shared<FixedSizeAttributeVector<uint32_t>>(base_segment->size());
+      _attribute_vector =
+          std::allocate_shared<FixedSizeAttributeVector<uint32_t>>(allocator, base_segment->size(), resource);
     }
 
     // Build up the attribute vector by looking up the index of the value in the dictionary for each value.
     // Because the dictionary is already sorted, we can use the efficient std::lower_bound method for performing a
     // binary search for the dictionary index.
-    for (size_t value_index = (ChunkOffset)0; value_index < base_segment->size(); value_index++) {
-      ValueID dictionary_index = ValueID{
-          std::distance(_dictionary->begin(), std::lower_bound(_dictionary->begin(), _dictionary->end(),
-                                                               type_cast<T>(base_segment->operator[](value_index))))};
-      _attribute_vector->set(value_index, dictionary_index);
+    // The lookup uses the sorted values, before they are (possibly) front coded.
+    segment_iterate<T>(*base_segment, [&](const T& value, const ChunkOffset chunk_offset) {
+      const auto dictionary_index = static_cast<ValueID::base_type>(
+          std::distance(values.cbegin(), std::lower_bound(values.cbegin(), values.cend(), value)));
+      _attribute_vector->set(chunk_offset, ValueID{dictionary_index});
+    });
+
+    // The dictionary is copied, so that it does not keep the unused capacity of the values vector
+    if constexpr (std::is_same_v<T, std::string>) {
+      _dictionary = std::allocate_shared<Dictionary>(allocator, values, resource);
+    } else {
+      _dictionary =
+          std::allocate_shared<Dictionary>(allocator, pmr_vector<T>(values.cbegin(), values.cend(), resource));
+    }
+  }
+
+  // Creates a Dictionary segment from an already sorted dictionary and a matching attribute vector, e.g., when loading
+  // a table from a file
+  DictionarySegment(std::shared_ptr<Dictionary> dictionary, std::shared_ptr<BaseAttributeVector> attribute_vector)
+      : _dictionary(std::move(dictionary)), _attribute_vector(std::move(attribute_vector)) {
+    if constexpr (!std::is_same_v<T, std::string>) {
+      DebugAssert(std::is_sorted(_dictionary->cbegin(), _dictionary->cend()), "The dictionary has to be sorted.");
     }
   }
 
@@ -80,19 +125,35 @@ class DictionarySegment : public BaseSegment {
   void append(const AllTypeVariant&) override { throw std::exception(); }
 
   // returns an underlying dictionary
-  std::shared_ptr<const std::vector<T>> dictionary() { return _dictionary; }
+  std::shared_ptr<const Dictionary> dictionary() const { return _dictionary; }
+
+  // returns all values of the dictionary in a vector. Front-coded dictionaries are decoded, which is much faster than
+  // accessing their values one by one. Other dictionaries are returned as they are.
+  std::shared_ptr<const DecodedDictionary> decoded_dictionary() const {
+    if constexpr (std::is_same_v<T, std::string>) {
+      auto values = _dictionary->decode();
+      return std::make_shared<DecodedDictionary>(std::make_move_iterator(values.begin()),
+                                                 std::make_move_iterator(values.end()));
+    } else {
+      return _dictionary;
+    }
+  }
 
   // returns an underlying data structure
-  std::shared_ptr<const BaseAttributeVector> attribute_vector() { return _attribute_vector; }
+  std::shared_ptr<const BaseAttributeVector> attribute_vector() const { return _attribute_vector; }
 
   // return the value represented by a given ValueID
-  const T& value_by_value_id(ValueID value_id) { return _dictionary->at(value_id); }
+  T value_by_value_id(ValueID value_id) const { return _dictionary->at(value_id); }
 
   // returns the first value ID that refers to a value >= the search value
   // returns INVALID_VALUE_ID if all values are smaller than the search value
   ValueID lower_bound(T value) const {
-    auto result = std::lower_bound(_dictionary->begin(), _dictionary->end(), value);
-    return result == _dictionary->end() ? INVALID_VALUE_ID : ValueID(std::distance(_dictionary->begin(), result));
+    if constexpr (std::is_same_v<T, std::string>) {
+      return _to_value_id(_dictionary->lower_bound(value));
+    } else {
+      return _to_value_id(std::distance(_dictionary->cbegin(),
+                                        std::lower_bound(_dictionary->cbegin(), _dictionary->cend(), value)));
+    }
   }
 
   // same as lower_bound(T), but accepts an AllTypeVariant
@@ -101,8 +162,12 @@ class DictionarySegment : public BaseSegment {
   // returns the first value ID that refers to a value > the search value
   // returns INVALID_VALUE_ID if all values are smaller than or equal to the search value
   ValueID upper_bound(T value) const {
-    auto result = std::upper_bound(_dictionary->begin(), _dictionary->end(), value);
-    return result == _dictionary->end() ? INVALID_VALUE_ID : ValueID(std::distance(_dictionary->begin(), result));
+    if constexpr (std::is_same_v<T, std::string>) {
+      return _to_value_id(_dictionary->upper_bound(value));
+    } else {
+      return _to_value_id(std::distance(_dictionary->cbegin(),
+                                        std::upper_bound(_dictionary->cbegin(), _dictionary->cend(), value)));
+    }
   }
 
   // same as upper_bound(T), but accepts an AllTypeVariant
@@ -116,13 +181,35 @@ class DictionarySegment : public BaseSegment {
 
   // returns the calculated memory usage
   size_t estimate_memory_usage() const final {
-    auto dictionary_size = sizeof(T) * _dictionary->size();
-    auto attribute_vector_size = _attribute_vector->width() * _attribute_vector->size();
-    return dictionary_size + attribute_vector_size;
+    auto dictionary_size = size_t{0};
+    if constexpr (std::is_same_v<T, std::string>) {
+      dictionary_size = _dictionary->estimate_memory_usage();
+    } else {
+      dictionary_size = sizeof(Dictionary) + heap_memory_usage(*_dictionary);
+    }
+    auto attribute_vector_size = _attribute_vector->estimate_memory_usage();
+    auto unused_arena_size = _arena ? _arena->unused_bytes() : size_t{0};
+    return sizeof(*this) + 2 * SHARED_PTR_CONTROL_BLOCK_SIZE + dictionary_size + attribute_vector_size +
+           unused_arena_size;
+  }
+
+  // the zone map comes for free, as the dictionary is sorted and holds every distinct value once
+  std::shared_ptr<const SegmentStatistics> compute_statistics() const final {
+    if (_dictionary->empty()) return nullptr;
+    return std::make_shared<SegmentStatistics>(
+        SegmentStatistics{_dictionary->front(), _dictionary->back(), _dictionary->size()});
   }
 
  protected:
-  std::shared_ptr<std::vector<T>> _dictionary;
+  // translates a dictionary index into a ValueID, the end of the dictionary becomes INVALID_VALUE_ID
+  ValueID _to_value_id(const size_t dictionary_index) const {
+    return dictionary_index == _dictionary->size() ? INVALID_VALUE_ID
+                                                   : ValueID{static_cast<ValueID::base_type>(dictionary_index)};
+  }
+
+  // the arena of a segment that was created by make_segment_in_arena, its unused bytes count as memory usage
+  std::shared_ptr<const SegmentArena> _arena;
+  std::shared_ptr<Dictionary> _dictionary;
   std::shared_ptr<BaseAttributeVector> _attribute_vector;
 };
 
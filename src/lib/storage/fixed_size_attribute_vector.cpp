@@ -2,14 +2,19 @@
 #include "fixed_size_attribute_vector.hpp"
 #include <boost/numeric/conversion/cast.hpp>
 #include <types.hpp>
+#include <utility>
 #include <vector>
 
+#include "utils/memory_usage.hpp"
+
 namespace opossum {
 
 template <typename T>
-FixedSizeAttributeVector<T>::FixedSizeAttributeVector(const size_t size) {
-  _values = std::vector<T>(size);
-}
+FixedSizeAttributeVector<T>::FixedSizeAttributeVector(const size_t size, const PolymorphicAllocator<T>& allocator)
+    : _values(pmr_vector<T>(size, allocator)) {}
+
+template <typename T>
+FixedSizeAttributeVector<T>::FixedSizeAttributeVector(SegmentBuffer<T>&& values) : _values(std::move(values)) {}
 
 // returns the value id at a given position
 template <typename T>
@@ -20,7 +25,7 @@ ValueID FixedSizeAttributeVector<T>::get(const size_t i) const {
 // sets the value id at a given position
 template <typename T>
 void FixedSizeAttributeVector<T>::set(const size_t i, const ValueID value_id) {
-  _values[i] = value_id;
+  _values.mutable_data()[i] = value_id;
 }
 
 // returns the number of values
@@ -30,15 +35,20 @@ size_t FixedSizeAttributeVector<T>::size() const {
 }
 
 // returns the width of biggest value id in bytes
+// Every value id is stored using sizeof(T) bytes, so there is no need to look at the stored values
 template <typename T>
 AttributeVectorWidth FixedSizeAttributeVector<T>::width() const {
-  AttributeVectorWidth max_width = 0;
-  for (uint32_t value_index = 0; value_index < _values.size(); value_index++) {
-    if (sizeof(_values[value_index]) > max_width) {
-      max_width = AttributeVectorWidth{sizeof(_values[value_index])};
-    }
-  }
-  return max_width;
+  return AttributeVectorWidth{sizeof(T)};
+}
+
+template <typename T>
+size_t FixedSizeAttributeVector<T>::estimate_memory_usage() const {
+  return sizeof(*this) + heap_memory_usage(_values);
+}
+
+template <typename T>
+const SegmentBuffer<T>& FixedSizeAttributeVector<T>::values() const {
+  return _values;
 }
 
 // Explicitly instantiate the template for the three possible integer types. This allows us to keep the code in the cpp file.
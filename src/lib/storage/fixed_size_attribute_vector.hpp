@@ -4,6 +4,7 @@
 #include <types.hpp>
 #include <vector>
 #include "base_attribute_vector.hpp"
+#include "segment_buffer.hpp"
 
 namespace opossum {
 
@@ -16,7 +17,10 @@ class FixedSizeAttributeVector : public BaseAttributeVector {
    *
    * @param size is a size_t indicating the fixed size that the attribute vector should reserve/use
    */
-  explicit FixedSizeAttributeVector(const size_t size);
+  explicit FixedSizeAttributeVector(const size_t size, const PolymorphicAllocator<T>& allocator = {});
+
+  // creates an attribute vector that holds the given value ids, e.g., when loading a table from a file
+  explicit FixedSizeAttributeVector(SegmentBuffer<T>&& values);
 
   // returns the value id at a given position
   ValueID get(const size_t i) const;
@@ -30,8 +34,15 @@ class FixedSizeAttributeVector : public BaseAttributeVector {
   // returns the width of biggest value id in bytes
   AttributeVectorWidth width() const;
 
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const;
+
+  // Returns the packed value ids. This allows operators to process the value ids in bulk (e.g., using SIMD) instead of
+  // calling the virtual get() for every position.
+  const SegmentBuffer<T>& values() const;
+
  protected:
-  std::vector<T> _values;
+  SegmentBuffer<T> _values;
 };
 
 }  // namespace opossum
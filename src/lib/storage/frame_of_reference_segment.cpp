@@ -0,0 +1,168 @@
+#include "frame_of_reference_segment.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "dictionary_segment.hpp"
+#include "segment_iterate.hpp"
+#include "utils/assert.hpp"
+#include "utils/memory_usage.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Computes value - minimum without signed overflow. The result is exact as long as value >= minimum.
+template <typename T>
+uint64_t offset_from_minimum(const T value, const T minimum) {
+  using Unsigned = std::make_unsigned_t<T>;
+  return static_cast<Unsigned>(static_cast<Unsigned>(value) - static_cast<Unsigned>(minimum));
+}
+
+template <typename T>
+T value_from_offset(const T minimum, const uint32_t offset) {
+  using Unsigned = std::make_unsigned_t<T>;
+  return static_cast<T>(static_cast<Unsigned>(static_cast<Unsigned>(minimum) + offset));
+}
+
+}  // namespace
+
+template <typename T>
+FrameOfReferenceSegment<T>::FrameOfReferenceSegment(const std::shared_ptr<BaseSegment>& base_segment,
+                                                    const ArenaAllocator<T>& allocator)
+    : _arena(allocator.arena()) {
+  std::vector<T> values;
+  values.reserve(base_segment->size());
+  segment_iterate<T>(*base_segment, [&](const T& value, const ChunkOffset) { values.push_back(value); });
+  Assert(values.size() == base_segment->size(), "FrameOfReferenceSegments cannot store NULL values");
+
+  const auto block_count = (values.size() + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  const auto resource = allocator.resource();
+  auto block_minima = pmr_vector<T>(block_count, resource);
+
+  // All blocks use the same bit width, which is determined by the block with the widest range of values
+  auto max_offset = uint64_t{0};
+  for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+    const auto block_begin = block_index * BLOCK_SIZE;
+    const auto block_end = std::min(values.size(), block_begin + BLOCK_SIZE);
+    const auto min_max = std::minmax_element(values.cbegin() + block_begin, values.cbegin() + block_end);
+    block_minima[block_index] = *min_max.first;
+    max_offset = std::max(max_offset, offset_from_minimum(*min_max.second, *min_max.first));
+  }
+  _block_minima = std::allocate_shared<SegmentBuffer<T>>(allocator, std::move(block_minima));
+  Assert(max_offset < (uint64_t{1} << MAX_BIT_WIDTH), "The values of a block are too far apart, see can_encode");
+
+  _offsets = std::allocate_shared<BitPackedAttributeVector>(
+      allocator, values.size(), BitPackedAttributeVector::required_bit_width(max_offset + 1), resource);
+  for (auto index = size_t{0}; index < values.size(); ++index) {
+    const auto offset = offset_from_minimum(values[index], (*_block_minima)[index / BLOCK_SIZE]);
+    _offsets->set(index, ValueID{static_cast<ValueID::base_type>(offset)});
+  }
+}
+
+template <typename T>
+FrameOfReferenceSegment<T>::FrameOfReferenceSegment(std::shared_ptr<SegmentBuffer<T>> block_minima,
+                                                    std::shared_ptr<BitPackedAttributeVector> offsets)
+    : _block_minima(std::move(block_minima)), _offsets(std::move(offsets)) {
+  Assert(_block_minima->size() == (_offsets->size() + BLOCK_SIZE - 1) / BLOCK_SIZE,
+         "Each block needs exactly one minimum.");
+  Assert(_offsets->bit_width() <= MAX_BIT_WIDTH, "The offsets use too many bits.");
+}
+
+template <typename T>
+bool FrameOfReferenceSegment<T>::can_encode(const BaseSegment& segment) {
+  std::vector<std::pair<T, T>> block_min_max((segment.size() + BLOCK_SIZE - 1) / BLOCK_SIZE,
+                                             {std::numeric_limits<T>::max(), std::numeric_limits<T>::min()});
+  auto value_count = size_t{0};
+  segment_iterate<T>(segment, [&](const T& value, const ChunkOffset chunk_offset) {
+    auto& min_max = block_min_max[chunk_offset / BLOCK_SIZE];
+    min_max.first = std::min(min_max.first, value);
+    min_max.second = std::max(min_max.second, value);
+    ++value_count;
+  });
+  if (value_count != segment.size()) return false;
+
+  return std::all_of(block_min_max.cbegin(), block_min_max.cend(), [](const auto& min_max) {
+    return offset_from_minimum(min_max.second, min_max.first) < (uint64_t{1} << MAX_BIT_WIDTH);
+  });
+}
+
+template <typename T>
+AllTypeVariant FrameOfReferenceSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+  return get(chunk_offset);
+}
+
+template <typename T>
+T FrameOfReferenceSegment<T>::get(const ChunkOffset chunk_offset) const {
+  return value_from_offset((*_block_minima)[chunk_offset / BLOCK_SIZE], _offsets->get(chunk_offset));
+}
+
+template <typename T>
+void FrameOfReferenceSegment<T>::append(const AllTypeVariant&) {
+  throw std::logic_error("FrameOfReferenceSegment is immutable");
+}
+
+template <typename T>
+std::shared_ptr<const SegmentBuffer<T>> FrameOfReferenceSegment<T>::block_minima() const {
+  return _block_minima;
+}
+
+template <typename T>
+std::shared_ptr<const BitPackedAttributeVector> FrameOfReferenceSegment<T>::offsets() const {
+  return _offsets;
+}
+
+template <typename T>
+size_t FrameOfReferenceSegment<T>::decode_block(const size_t block_index, T* output) const {
+  DebugAssert(block_index < _block_minima->size(), "There exists no block with the given index.");
+  const auto first_index = block_index * BLOCK_SIZE;
+  const auto count = std::min(BLOCK_SIZE, size() - first_index);
+
+  std::array<uint32_t, BLOCK_SIZE> offsets;
+  _offsets->decode(first_index, count, offsets.data());
+
+  const auto minimum = (*_block_minima)[block_index];
+  for (auto index = size_t{0}; index < count; ++index) output[index] = value_from_offset(minimum, offsets[index]);
+  return count;
+}
+
+template <typename T>
+size_t FrameOfReferenceSegment<T>::size() const {
+  return _offsets->size();
+}
+
+template <typename T>
+size_t FrameOfReferenceSegment<T>::estimate_memory_usage() const {
+  return sizeof(*this) + 2 * SHARED_PTR_CONTROL_BLOCK_SIZE + sizeof(SegmentBuffer<T>) +
+         heap_memory_usage(*_block_minima) + _offsets->estimate_memory_usage() + (_arena ? _arena->unused_bytes() : 0);
+}
+
+template <typename T>
+std::shared_ptr<const SegmentStatistics> FrameOfReferenceSegment<T>::compute_statistics() const {
+  if (_block_minima->empty()) return nullptr;
+
+  auto max = std::numeric_limits<T>::min();
+  std::array<uint32_t, BLOCK_SIZE> offsets;
+  for (auto block_index = size_t{0}; block_index < _block_minima->size(); ++block_index) {
+    const auto first_index = block_index * BLOCK_SIZE;
+    const auto count = std::min(BLOCK_SIZE, size() - first_index);
+    _offsets->decode(first_index, count, offsets.data());
+    const auto max_offset = *std::max_element(offsets.cbegin(), offsets.cbegin() + count);
+    max = std::max(max, value_from_offset((*_block_minima)[block_index], max_offset));
+  }
+  const auto min = *std::min_element(_block_minima->cbegin(), _block_minima->cend());
+  return std::make_shared<SegmentStatistics>(SegmentStatistics{min, max, std::nullopt});
+}
+
+// Only the integer data types can be frame-of-reference encoded
+template class FrameOfReferenceSegment<int32_t>;
+template class FrameOfReferenceSegment<int64_t>;
+
+}  // namespace opossum
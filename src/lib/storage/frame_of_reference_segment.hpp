@@ -0,0 +1,80 @@
+#pragma once
+
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "base_segment.hpp"
+#include "bit_packed_attribute_vector.hpp"
+#include "segment_arena.hpp"
+#include "segment_buffer.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// FrameOfReferenceSegment is an immutable segment type for integer columns (int and long). The values are split into
+// blocks of BLOCK_SIZE rows. For each block, the minimum is stored once and every value is stored as its offset from
+// that minimum in a BitPackedAttributeVector. Columns with narrow value ranges, e.g., ids or timestamps, thus only need
+// a few bits per value, and encoding them neither sorts the values nor builds a dictionary.
+//
+// The offsets of a block can be decoded with AVX2 (see BitPackedAttributeVector::decode). Scans translate their
+// predicate into a range of offsets per block instead of decoding the values.
+template <typename T>
+class FrameOfReferenceSegment : public BaseSegment {
+  static_assert(std::is_integral_v<T>, "Frame-of-reference encoding is only supported for integer types.");
+
+ public:
+  static constexpr auto BLOCK_SIZE = size_t{2048};
+
+  // Offsets use at most this many bits, so that every range of offsets (and its size) fits into a ValueID
+  static constexpr auto MAX_BIT_WIDTH = uint8_t{31};
+
+  // creates a frame-of-reference encoded segment from a given segment (usually a ValueSegment). Check can_encode
+  // first, segments with blocks whose values are too far apart cannot be encoded. The blocks are allocated with the
+  // allocator and share the ownership of its arena.
+  explicit FrameOfReferenceSegment(const std::shared_ptr<BaseSegment>& base_segment,
+                                   const ArenaAllocator<T>& allocator = {});
+
+  // creates a segment from already encoded blocks, e.g., when loading a table from a file
+  FrameOfReferenceSegment(std::shared_ptr<SegmentBuffer<T>> block_minima,
+                          std::shared_ptr<BitPackedAttributeVector> offsets);
+
+  // returns whether the difference between the minimum and the maximum of every block fits into MAX_BIT_WIDTH bits
+  static bool can_encode(const BaseSegment& segment);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  // returns the value at a certain position
+  T get(const ChunkOffset chunk_offset) const;
+
+  // frame-of-reference encoded segments are immutable
+  void append(const AllTypeVariant&) final;
+
+  // returns the minimum of each block
+  std::shared_ptr<const SegmentBuffer<T>> block_minima() const;
+
+  // returns the offset of each value from the minimum of its block
+  std::shared_ptr<const BitPackedAttributeVector> offsets() const;
+
+  // Decodes the values of the block with the given index into output, which has to hold BLOCK_SIZE values. Returns
+  // the number of values in the block, which is smaller than BLOCK_SIZE only for the last block.
+  size_t decode_block(const size_t block_index, T* output) const;
+
+  // return the number of entries
+  size_t size() const final;
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const final;
+
+  // the zone map is computed from the block minima and the largest offset of each block
+  std::shared_ptr<const SegmentStatistics> compute_statistics() const final;
+
+ protected:
+  // the arena of a segment that was created by make_segment_in_arena, its unused bytes count as memory usage
+  std::shared_ptr<const SegmentArena> _arena;
+  std::shared_ptr<SegmentBuffer<T>> _block_minima;
+  std::shared_ptr<BitPackedAttributeVector> _offsets;
+};
+
+}  // namespace opossum
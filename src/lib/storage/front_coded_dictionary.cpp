@@ -0,0 +1,185 @@
+#include "front_coded_dictionary.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <string_view>  // NOLINT(build/include_order)
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+#include "utils/memory_usage.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Lengths are stored with seven bits per byte. The highest bit of a byte is set if more bytes follow.
+void write_length(std::vector<char>& bytes, size_t length) {
+  while (length >= 0x80) {
+    bytes.push_back(static_cast<char>((length & 0x7F) | 0x80));
+    length >>= 7;
+  }
+  bytes.push_back(static_cast<char>(length));
+}
+
+size_t read_length(const char*& position) {
+  auto length = size_t{0};
+  auto shift = 0u;
+  auto byte = uint8_t{0};
+  do {
+    byte = static_cast<uint8_t>(*position++);
+    length |= static_cast<size_t>(byte & 0x7F) << shift;
+    shift += 7;
+  } while (byte & 0x80);
+  return length;
+}
+
+// Decodes the strings of a block one after another into a buffer that is reused for every string
+class BlockDecoder {
+ public:
+  explicit BlockDecoder(const char* position) : _position(position) {}
+
+  // decodes the next string of the block, the first call decodes the head
+  const std::string& next() {
+    const auto prefix_length = _is_head ? size_t{0} : read_length(_position);
+    const auto suffix_length = read_length(_position);
+    _value.resize(prefix_length);
+    _value.append(_position, suffix_length);
+    _position += suffix_length;
+    _is_head = false;
+    return _value;
+  }
+
+ protected:
+  const char* _position;
+  bool _is_head = true;
+  std::string _value;
+};
+
+// Front codes sorted, distinct strings. Returns the encoded blocks and the position of each block within them.
+std::pair<SegmentBuffer<char>, SegmentBuffer<uint64_t>> front_code(const std::vector<std::string>& values,
+                                                                   const PolymorphicAllocator<char>& allocator) {
+  DebugAssert(std::adjacent_find(values.cbegin(), values.cend(), std::greater_equal<std::string>{}) == values.cend(),
+              "The values have to be sorted and distinct.");
+  auto block_offsets = pmr_vector<uint64_t>(allocator);
+  block_offsets.reserve((values.size() + FrontCodedDictionary::BLOCK_SIZE - 1) / FrontCodedDictionary::BLOCK_SIZE);
+
+  // The size of the buffer is unknown until all strings are encoded. It grows in a temporary vector, so that the
+  // allocator only has to provide the final buffer.
+  std::vector<char> bytes;
+  for (auto index = size_t{0}; index < values.size(); ++index) {
+    const auto& value = values[index];
+    if (index % FrontCodedDictionary::BLOCK_SIZE == 0) {
+      block_offsets.push_back(bytes.size());
+      write_length(bytes, value.size());
+      bytes.insert(bytes.end(), value.cbegin(), value.cend());
+      continue;
+    }
+
+    const auto& previous_value = values[index - 1];
+    const auto max_prefix_length = std::min(value.size(), previous_value.size());
+    const auto prefix_length = static_cast<size_t>(
+        std::mismatch(value.cbegin(), value.cbegin() + max_prefix_length, previous_value.cbegin()).first -
+        value.cbegin());
+    write_length(bytes, prefix_length);
+    write_length(bytes, value.size() - prefix_length);
+    bytes.insert(bytes.end(), value.cbegin() + prefix_length, value.cend());
+  }
+  return {SegmentBuffer<char>{pmr_vector<char>(bytes.cbegin(), bytes.cend(), allocator)},
+          SegmentBuffer<uint64_t>{std::move(block_offsets)}};
+}
+
+}  // namespace
+
+FrontCodedDictionary::FrontCodedDictionary(const std::vector<std::string>& values,
+                                           const PolymorphicAllocator<char>& allocator)
+    : FrontCodedDictionary(front_code(values, allocator), values.size()) {}
+
+FrontCodedDictionary::FrontCodedDictionary(SegmentBuffer<char>&& bytes, SegmentBuffer<uint64_t>&& block_offsets,
+                                           const size_t size)
+    : _bytes(std::move(bytes)), _block_offsets(std::move(block_offsets)), _size(size) {
+  Assert(_block_offsets.size() == (_size + BLOCK_SIZE - 1) / BLOCK_SIZE, "Each block needs exactly one offset.");
+  Assert(std::all_of(_block_offsets.cbegin(), _block_offsets.cend(),
+                     [&](const auto block_offset) { return block_offset < _bytes.size(); }),
+         "The block offsets have to point into the buffer.");
+}
+
+std::string FrontCodedDictionary::operator[](const size_t index) const {
+  DebugAssert(index < _size, "There exists no string with the given index.");
+  auto decoder = BlockDecoder{_bytes.data() + _block_offsets[index / BLOCK_SIZE]};
+  for (auto block_index = size_t{0}; block_index < index % BLOCK_SIZE; ++block_index) decoder.next();
+  return decoder.next();
+}
+
+std::string FrontCodedDictionary::at(const size_t index) const {
+  if (index >= _size) throw std::out_of_range("There exists no string with the given index.");
+  return (*this)[index];
+}
+
+std::string FrontCodedDictionary::front() const { return at(0); }
+
+std::string FrontCodedDictionary::back() const { return at(_size - 1); }
+
+size_t FrontCodedDictionary::lower_bound(const std::string_view value) const { return _bound(value, true); }
+
+size_t FrontCodedDictionary::upper_bound(const std::string_view value) const { return _bound(value, false); }
+
+std::vector<std::string> FrontCodedDictionary::decode() const {
+  std::vector<std::string> values;
+  values.reserve(_size);
+  for (auto block_index = size_t{0}; block_index < _block_offsets.size(); ++block_index) {
+    auto decoder = BlockDecoder{_bytes.data() + _block_offsets[block_index]};
+    const auto block_size = std::min(BLOCK_SIZE, _size - block_index * BLOCK_SIZE);
+    for (auto index = size_t{0}; index < block_size; ++index) values.push_back(decoder.next());
+  }
+  return values;
+}
+
+size_t FrontCodedDictionary::size() const { return _size; }
+
+bool FrontCodedDictionary::empty() const { return _size == 0; }
+
+const SegmentBuffer<char>& FrontCodedDictionary::bytes() const { return _bytes; }
+
+const SegmentBuffer<uint64_t>& FrontCodedDictionary::block_offsets() const { return _block_offsets; }
+
+size_t FrontCodedDictionary::estimate_memory_usage() const {
+  return sizeof(*this) + heap_memory_usage(_bytes) + heap_memory_usage(_block_offsets);
+}
+
+std::string_view FrontCodedDictionary::_block_head(const size_t block_index) const {
+  auto position = _bytes.data() + _block_offsets[block_index];
+  const auto length = read_length(position);
+  return std::string_view{position, length};
+}
+
+size_t FrontCodedDictionary::_bound(const std::string_view value, const bool inclusive) const {
+  // Find the first block whose head is > value. The bound lies within the block before it (or is its head).
+  auto block_begin = size_t{0};
+  auto block_end = _block_offsets.size();
+  while (block_begin < block_end) {
+    const auto block_index = block_begin + (block_end - block_begin) / 2;
+    if (_block_head(block_index) <= value) {
+      block_begin = block_index + 1;
+    } else {
+      block_end = block_index;
+    }
+  }
+  if (block_begin == 0) return 0;
+
+  const auto block_index = block_begin - 1;
+  const auto first_index = block_index * BLOCK_SIZE;
+  const auto block_size = std::min(BLOCK_SIZE, _size - first_index);
+  auto decoder = BlockDecoder{_bytes.data() + _block_offsets[block_index]};
+  for (auto index = size_t{0}; index < block_size; ++index) {
+    const auto& current_value = decoder.next();
+    if (inclusive ? std::string_view{current_value} >= value : std::string_view{current_value} > value) {
+      return first_index + index;
+    }
+  }
+  return first_index + block_size;
+}
+
+}  // namespace opossum
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>  // NOLINT(build/include_order)
+#include <utility>
+#include <vector>
+
+#include "segment_buffer.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Sorted dictionary of distinct strings that is stored in a single contiguous byte buffer. The strings are grouped
+// into blocks of BLOCK_SIZE strings. The first string of each block (its head) is stored completely. Every following
+// string only stores the length of the prefix it shares with its predecessor and the remaining suffix (front coding).
+// All lengths are stored as variable-length integers, so short strings need a single byte per length.
+//
+// Columns such as URLs or product names, whose sorted values share long prefixes, take a fraction of the memory of a
+// std::vector<std::string>, which needs 32 bytes plus a heap allocation for every longer string. Lookups binary
+// search the block heads and then decode at most one block.
+class FrontCodedDictionary {
+ public:
+  static constexpr auto BLOCK_SIZE = size_t{16};
+
+  // creates an empty dictionary
+  FrontCodedDictionary() = default;
+
+  // creates a dictionary from sorted, distinct strings
+  explicit FrontCodedDictionary(const std::vector<std::string>& values,
+                                const PolymorphicAllocator<char>& allocator = {});
+
+  // creates a dictionary from an already encoded buffer, e.g., when loading a table from a file
+  FrontCodedDictionary(SegmentBuffer<char>&& bytes, SegmentBuffer<uint64_t>&& block_offsets, const size_t size);
+
+  // returns the string at the given index. This decodes the block up to the index.
+  std::string operator[](const size_t index) const;
+
+  // same as operator[], but checks the index
+  std::string at(const size_t index) const;
+
+  std::string front() const;
+  std::string back() const;
+
+  // returns the index of the first string >= value, or size() if there is none
+  size_t lower_bound(const std::string_view value) const;
+
+  // returns the index of the first string > value, or size() if there is none
+  size_t upper_bound(const std::string_view value) const;
+
+  // decodes all strings at once, which is much faster than accessing them one by one
+  std::vector<std::string> decode() const;
+
+  // returns the number of strings
+  size_t size() const;
+
+  bool empty() const;
+
+  // returns the encoded blocks
+  const SegmentBuffer<char>& bytes() const;
+
+  // returns the position of each block within bytes()
+  const SegmentBuffer<uint64_t>& block_offsets() const;
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const;
+
+ protected:
+  FrontCodedDictionary(std::pair<SegmentBuffer<char>, SegmentBuffer<uint64_t>>&& blocks, const size_t size)
+      : FrontCodedDictionary(std::move(blocks.first), std::move(blocks.second), size) {}
+
+  // returns the head of a block without copying it
+  std::string_view _block_head(const size_t block_index) const;
+
+  // Returns the index of the first string in the block that value precedes, i.e., that is > value (or >= value if
+  // inclusive is set). Only the block whose head is the last one <= value has to be decoded.
+  size_t _bound(const std::string_view value, const bool inclusive) const;
+
+  SegmentBuffer<char> _bytes;
+  SegmentBuffer<uint64_t> _block_offsets;
+  size_t _size = 0;
+};
+
+}  // namespace opossum
@@ -0,0 +1,110 @@
+#include "pos_list.hpp"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+#include "utils/memory_usage.hpp"
+
+namespace opossum {
+
+PosList::PosList(std::initializer_list<RowID> row_ids) : _row_ids(row_ids) {}
+
+PosList::PosList(std::vector<RowID>&& row_ids) : _row_ids(std::move(row_ids)) {}
+
+PosList::PosList(const ChunkID chunk_id) : _form(Form::Range), _chunk_id(chunk_id) {}
+
+void PosList::push_back(const RowID& row_id) {
+  if (_form == Form::RowIDs) {
+    _row_ids.push_back(row_id);
+    return;
+  }
+  DebugAssert(row_id.chunk_id == _chunk_id, "The position does not point into the common chunk of the position list");
+  push_back(row_id.chunk_offset);
+}
+
+void PosList::push_back_range(const ChunkOffset begin, const ChunkOffset end) {
+  DebugAssert(_form != Form::RowIDs, "Only single-chunk position lists can store ranges");
+  if (begin >= end) return;
+  if (_form == Form::Range) {
+    if (_range_begin == _range_end) {
+      _range_begin = begin;
+      _range_end = end;
+      return;
+    }
+    if (begin == _range_end) {
+      _range_end = end;
+      return;
+    }
+    _materialize_range();
+  }
+  for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) _chunk_offsets.push_back(chunk_offset);
+}
+
+void PosList::reserve(const size_t size) {
+  if (_form == Form::RowIDs) _row_ids.reserve(size);
+  if (_form == Form::ChunkOffsets) _chunk_offsets.reserve(size);
+}
+
+size_t PosList::size() const {
+  switch (_form) {
+    case Form::RowIDs:
+      return _row_ids.size();
+    case Form::ChunkOffsets:
+      return _chunk_offsets.size();
+    case Form::Range:
+      return _range_end - _range_begin;
+  }
+  Fail("Unknown position list form");
+  return 0;
+}
+
+bool PosList::empty() const { return size() == 0; }
+
+RowID PosList::operator[](const size_t index) const {
+  DebugAssert(index < size(), "There exists no position with the given index.");
+  switch (_form) {
+    case Form::RowIDs:
+      return _row_ids[index];
+    case Form::ChunkOffsets:
+      return RowID{_chunk_id, _chunk_offsets[index]};
+    case Form::Range:
+      return RowID{_chunk_id, static_cast<ChunkOffset>(_range_begin + index)};
+  }
+  Fail("Unknown position list form");
+  return NULL_ROW_ID;
+}
+
+PosList::Iterator PosList::begin() const { return Iterator{*this, 0}; }
+
+PosList::Iterator PosList::end() const { return Iterator{*this, size()}; }
+
+bool PosList::references_single_chunk() const { return _form != Form::RowIDs; }
+
+ChunkID PosList::common_chunk_id() const {
+  DebugAssert(references_single_chunk(), "The position list may point into several chunks");
+  return _chunk_id;
+}
+
+bool PosList::is_range() const { return _form == Form::Range; }
+
+size_t PosList::estimate_memory_usage() const {
+  return sizeof(*this) + heap_memory_usage(_row_ids) + heap_memory_usage(_chunk_offsets);
+}
+
+bool PosList::operator==(const PosList& other) const {
+  return size() == other.size() && std::equal(begin(), end(), other.begin());
+}
+
+bool PosList::operator!=(const PosList& other) const { return !(*this == other); }
+
+void PosList::_materialize_range() {
+  _chunk_offsets.reserve(std::max(size_t{_range_end - _range_begin} * 2, size_t{16}));
+  for (auto chunk_offset = _range_begin; chunk_offset < _range_end; ++chunk_offset) {
+    _chunk_offsets.push_back(chunk_offset);
+  }
+  _form = Form::ChunkOffsets;
+}
+
+}  // namespace opossum
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// The positions of the rows that a ReferenceSegment references.
+//
+// Most position lists, e.g., those of scans, only point into a single chunk. Such a list is created with the id of
+// that chunk and stores 4-byte ChunkOffsets instead of 8-byte RowIDs. As long as its offsets are contiguous, e.g.,
+// because all rows of a run or of the whole chunk match, only the bounds of that range are stored. Position lists that
+// span several chunks or contain NULL_ROW_ID store RowIDs.
+//
+// Callers that process every position should use for_each_chunk, which resolves the storage form once per chunk
+// instead of once per position.
+class PosList {
+ public:
+  // Iterates over the positions as RowIDs, whatever form they are stored in
+  class Iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = RowID;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const RowID*;
+    using reference = RowID;
+
+    Iterator(const PosList& pos_list, const size_t index) : _pos_list(&pos_list), _index(index) {}
+
+    RowID operator*() const { return (*_pos_list)[_index]; }
+
+    Iterator& operator++() {
+      ++_index;
+      return *this;
+    }
+
+    bool operator==(const Iterator& other) const { return _index == other._index; }
+    bool operator!=(const Iterator& other) const { return _index != other._index; }
+
+   protected:
+    const PosList* _pos_list;
+    size_t _index;
+  };
+
+  // creates an empty position list that may point into any chunk
+  PosList() = default;
+  PosList(std::initializer_list<RowID> row_ids);
+  explicit PosList(std::vector<RowID>&& row_ids);
+
+  // creates an empty position list whose positions all point into the given chunk
+  explicit PosList(const ChunkID chunk_id);
+
+  // Appends a position. If the list references a single chunk, the position has to point into that chunk.
+  void push_back(const RowID& row_id);
+
+  // Appends a position within the common chunk of a single-chunk list. Contiguous offsets extend the stored range.
+  void push_back(const ChunkOffset chunk_offset) {
+    DebugAssert(_form != Form::RowIDs, "Only single-chunk position lists can store ChunkOffsets");
+    if (_form == Form::Range) {
+      if (_range_begin == _range_end) {
+        _range_begin = chunk_offset;
+        _range_end = chunk_offset + 1;
+        return;
+      }
+      if (chunk_offset == _range_end) {
+        ++_range_end;
+        return;
+      }
+      _materialize_range();
+    }
+    _chunk_offsets.push_back(chunk_offset);
+  }
+
+  // Appends all offsets in [begin, end) within the common chunk of a single-chunk list, e.g., a matching run
+  void push_back_range(const ChunkOffset begin, const ChunkOffset end);
+
+  void reserve(const size_t size);
+
+  size_t size() const;
+  bool empty() const;
+
+  RowID operator[](const size_t index) const;
+
+  Iterator begin() const;
+  Iterator end() const;
+
+  // returns whether all positions point into common_chunk_id()
+  bool references_single_chunk() const;
+  ChunkID common_chunk_id() const;
+
+  // returns whether the positions of a single-chunk list are stored as one contiguous range of offsets
+  bool is_range() const;
+
+  // Calls functor(chunk_id, begin_index, end_index, chunk_offset_at) for each run of positions that point into the
+  // same chunk. chunk_offset_at(index) returns the offset within that chunk of every index in [begin_index, end_index).
+  // Runs of NULL_ROW_ID are skipped.
+  template <typename Functor>
+  void for_each_chunk(const Functor& functor) const {
+    switch (_form) {
+      case Form::Range:
+        if (_range_begin == _range_end) return;
+        functor(_chunk_id, size_t{0}, size(),
+                [&](const size_t index) { return static_cast<ChunkOffset>(_range_begin + index); });
+        return;
+      case Form::ChunkOffsets:
+        if (_chunk_offsets.empty()) return;
+        functor(_chunk_id, size_t{0}, size(), [&](const size_t index) { return _chunk_offsets[index]; });
+        return;
+      case Form::RowIDs:
+        auto run_begin = size_t{0};
+        while (run_begin < _row_ids.size()) {
+          const auto chunk_id = _row_ids[run_begin].chunk_id;
+          auto run_end = run_begin + 1;
+          while (run_end < _row_ids.size() && _row_ids[run_end].chunk_id == chunk_id) ++run_end;
+          if (chunk_id != NULL_ROW_ID.chunk_id) {
+            functor(chunk_id, run_begin, run_end, [&](const size_t index) { return _row_ids[index].chunk_offset; });
+          }
+          run_begin = run_end;
+        }
+        return;
+    }
+  }
+
+  // returns the memory usage of the object and of the positions it stores
+  size_t estimate_memory_usage() const;
+
+  // compares the positions, no matter in which form they are stored
+  bool operator==(const PosList& other) const;
+  bool operator!=(const PosList& other) const;
+
+ protected:
+  enum class Form { RowIDs, ChunkOffsets, Range };
+
+  // Switches a single-chunk list from Form::Range to Form::ChunkOffsets
+  void _materialize_range();
+
+  Form _form = Form::RowIDs;
+  ChunkID _chunk_id{0};
+
+  // Form::RowIDs
+  std::vector<RowID> _row_ids;
+
+  // Form::ChunkOffsets
+  std::vector<ChunkOffset> _chunk_offsets;
+
+  // Form::Range, i.e., the offsets [_range_begin, _range_end)
+  ChunkOffset _range_begin{0};
+  ChunkOffset _range_end{0};
+};
+
+}  // namespace opossum
@@ -0,0 +1,41 @@
+#include "reference_segment.hpp"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+#include "utils/memory_usage.hpp"
+
+namespace opossum {
+
+ReferenceSegment::ReferenceSegment(const std::shared_ptr<const Table> referenced_table,
+                                   const ColumnID referenced_column_id, const std::shared_ptr<const PosList> pos)
+    : _referenced_table(referenced_table), _referenced_column_id(referenced_column_id), _pos_list(pos) {}
+
+AllTypeVariant ReferenceSegment::operator[](const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset < _pos_list->size(), "There exists no value with the given position.");
+  const auto& row_id = (*_pos_list)[chunk_offset];
+  if (row_id == NULL_ROW_ID) return NULL_VALUE;
+  const auto chunk = _referenced_table->get_chunk(row_id.chunk_id);
+  return (*chunk->get_segment(_referenced_column_id))[row_id.chunk_offset];
+}
+
+size_t ReferenceSegment::size() const { return _pos_list->size(); }
+
+size_t ReferenceSegment::estimate_memory_usage() const {
+  return estimate_memory_usage_without_pos_list() + SHARED_PTR_CONTROL_BLOCK_SIZE + _pos_list->estimate_memory_usage();
+}
+
+size_t ReferenceSegment::estimate_memory_usage_without_pos_list() const { return sizeof(*this); }
+
+std::shared_ptr<const SegmentStatistics> ReferenceSegment::compute_statistics() const { return nullptr; }
+
+const std::shared_ptr<const PosList> ReferenceSegment::pos_list() const { return _pos_list; }
+
+const std::shared_ptr<const Table> ReferenceSegment::referenced_table() const { return _referenced_table; }
+
+ColumnID ReferenceSegment::referenced_column_id() const { return _referenced_column_id; }
+
+}  // namespace opossum
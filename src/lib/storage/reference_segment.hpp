@@ -8,7 +8,7 @@
 #include <vector>
 
 #include "base_segment.hpp"
-#include "dictionary_segment.hpp"
+#include "pos_list.hpp"
 #include "table.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -30,10 +30,24 @@ class ReferenceSegment : public BaseSegment {
 
   size_t size() const override;
 
+  // returns the memory usage of the segment and its position list, the referenced table is not counted
+  size_t estimate_memory_usage() const override;
+
+  // returns the memory usage of the segment without its position list, which may be shared with other segments
+  size_t estimate_memory_usage_without_pos_list() const;
+
+  // computing a zone map would require resolving every position, so reference segments do not provide one
+  std::shared_ptr<const SegmentStatistics> compute_statistics() const override;
+
   const std::shared_ptr<const PosList> pos_list() const;
   const std::shared_ptr<const Table> referenced_table() const;
 
   ColumnID referenced_column_id() const;
+
+ protected:
+  const std::shared_ptr<const Table> _referenced_table;
+  const ColumnID _referenced_column_id;
+  const std::shared_ptr<const PosList> _pos_list;
 };
 
 }  // namespace opossum
@@ -0,0 +1,112 @@
+#include "run_length_segment.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "dictionary_segment.hpp"
+#include "segment_iterate.hpp"
+#include "utils/assert.hpp"
+#include "utils/memory_usage.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+template <typename T>
+RunLengthSegment<T>::RunLengthSegment(const std::shared_ptr<BaseSegment>& base_segment,
+                                      const ArenaAllocator<T>& allocator)
+    : _arena(allocator.arena()) {
+  // A new run starts whenever the value differs from the previous one. The end position of the current run is moved
+  // forward with every value that continues it. The number of runs is unknown until all values are read, so the runs
+  // are collected in temporary vectors and the allocator only has to provide the final ones.
+  std::vector<T> values;
+  std::vector<ChunkOffset> end_positions;
+  segment_iterate<T>(*base_segment, [&](const T& value, const ChunkOffset chunk_offset) {
+    if (values.empty() || values.back() != value) {
+      values.push_back(value);
+      end_positions.push_back(chunk_offset);
+    } else {
+      end_positions.back() = chunk_offset;
+    }
+  });
+
+  const auto resource = allocator.resource();
+  _values = std::allocate_shared<Values>(allocator, pmr_vector<T>(values.cbegin(), values.cend(), resource));
+  _end_positions = std::allocate_shared<SegmentBuffer<ChunkOffset>>(
+      allocator, pmr_vector<ChunkOffset>(end_positions.cbegin(), end_positions.cend(), resource));
+  Assert(size() == base_segment->size(), "RunLengthSegments cannot store NULL values");
+}
+
+template <typename T>
+RunLengthSegment<T>::RunLengthSegment(std::shared_ptr<Values> values,
+                                      std::shared_ptr<SegmentBuffer<ChunkOffset>> end_positions)
+    : _values(std::move(values)), _end_positions(std::move(end_positions)) {
+  Assert(_values->size() == _end_positions->size(), "Each run needs a value and an end position.");
+  DebugAssert(std::adjacent_find(_end_positions->cbegin(), _end_positions->cend(), std::greater_equal<ChunkOffset>{}) ==
+                  _end_positions->cend(),
+              "The end positions have to be strictly increasing.");
+}
+
+template <typename T>
+AllTypeVariant RunLengthSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+  return get(chunk_offset);
+}
+
+template <typename T>
+const T& RunLengthSegment<T>::get(const ChunkOffset chunk_offset) const {
+  return (*_values)[run_index(chunk_offset)];
+}
+
+template <typename T>
+void RunLengthSegment<T>::append(const AllTypeVariant&) {
+  throw std::logic_error("RunLengthSegment is immutable");
+}
+
+template <typename T>
+std::shared_ptr<const typename RunLengthSegment<T>::Values> RunLengthSegment<T>::values() const {
+  return _values;
+}
+
+template <typename T>
+std::shared_ptr<const SegmentBuffer<ChunkOffset>> RunLengthSegment<T>::end_positions() const {
+  return _end_positions;
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::run_index(const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset < size(), "There exists no value with the given position.");
+  // The run of a position is the first one that ends at or after it
+  return std::distance(_end_positions->cbegin(),
+                       std::lower_bound(_end_positions->cbegin(), _end_positions->cend(), chunk_offset));
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::run_count() const {
+  return _values->size();
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::size() const {
+  return _end_positions->empty() ? 0 : _end_positions->back() + size_t{1};
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::estimate_memory_usage() const {
+  return sizeof(*this) + 2 * SHARED_PTR_CONTROL_BLOCK_SIZE + sizeof(Values) + sizeof(SegmentBuffer<ChunkOffset>) +
+         heap_memory_usage(*_values) + heap_memory_usage(*_end_positions) + (_arena ? _arena->unused_bytes() : 0);
+}
+
+template <typename T>
+std::shared_ptr<const SegmentStatistics> RunLengthSegment<T>::compute_statistics() const {
+  if (_values->empty()) return nullptr;
+  const auto min_max = std::minmax_element(_values->cbegin(), _values->cend());
+  return std::make_shared<SegmentStatistics>(SegmentStatistics{*min_max.first, *min_max.second, std::nullopt});
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(RunLengthSegment);
+
+}  // namespace opossum
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "base_segment.hpp"
+#include "segment_arena.hpp"
+#include "segment_buffer.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// RunLengthSegment is an immutable segment type that stores each run of equal consecutive values only once. For every
+// run, it stores the value and the position of the run's last row (the end position). Columns that are sorted or
+// consist of long runs, e.g., status flags, shrink far below the size of a dictionary, and scans only have to evaluate
+// their predicate once per run.
+template <typename T>
+class RunLengthSegment : public BaseSegment {
+ public:
+  // Strings cannot be referenced in a file, so they are stored in a vector
+  using Values = std::conditional_t<std::is_same_v<T, std::string>, pmr_vector<T>, SegmentBuffer<T>>;
+
+  // creates a run-length encoded segment from a given segment (usually a ValueSegment). The runs are allocated with the
+  // allocator and share the ownership of its arena.
+  explicit RunLengthSegment(const std::shared_ptr<BaseSegment>& base_segment, const ArenaAllocator<T>& allocator = {});
+
+  // creates a segment from already encoded runs, e.g., when loading a table from a file. The end positions have to be
+  // strictly increasing.
+  RunLengthSegment(std::shared_ptr<Values> values, std::shared_ptr<SegmentBuffer<ChunkOffset>> end_positions);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  // returns the value at a certain position, the run is found by a binary search over the end positions
+  const T& get(const ChunkOffset chunk_offset) const;
+
+  // run-length encoded segments are immutable
+  void append(const AllTypeVariant&) final;
+
+  // returns the value of each run
+  std::shared_ptr<const Values> values() const;
+
+  // returns the position of the last row of each run
+  std::shared_ptr<const SegmentBuffer<ChunkOffset>> end_positions() const;
+
+  // returns the index of the run that contains the given position
+  size_t run_index(const ChunkOffset chunk_offset) const;
+
+  // return the number of runs
+  size_t run_count() const;
+
+  // return the number of entries
+  size_t size() const final;
+
+  // returns the calculated memory usage
+  size_t estimate_memory_usage() const final;
+
+  // the zone map only has to look at each run once
+  std::shared_ptr<const SegmentStatistics> compute_statistics() const final;
+
+ protected:
+  // the arena of a segment that was created by make_segment_in_arena, its unused bytes count as memory usage
+  std::shared_ptr<const SegmentArena> _arena;
+  std::shared_ptr<Values> _values;
+  std::shared_ptr<SegmentBuffer<ChunkOffset>> _end_positions;
+};
+
+}  // namespace opossum
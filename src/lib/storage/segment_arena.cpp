@@ -0,0 +1,35 @@
+#include "segment_arena.hpp"
+
+namespace opossum {
+
+SegmentArena::SegmentArena(const size_t initial_size) : _buffers(initial_size, &_counter) {}
+
+size_t SegmentArena::unused_bytes() const { return _counter.reserved_bytes - _allocated_bytes; }
+
+void* SegmentArena::do_allocate(const size_t bytes, const size_t alignment) {
+  _allocated_bytes += bytes;
+  return _buffers.allocate(bytes, alignment);
+}
+
+void SegmentArena::do_deallocate(void* pointer, const size_t bytes, const size_t alignment) {
+  // Monotonic buffers are only released as a whole, the bytes stay allocated until then
+  _buffers.deallocate(pointer, bytes, alignment);
+}
+
+bool SegmentArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept { return this == &other; }
+
+void* SegmentArena::ReservedBytesCounter::do_allocate(const size_t bytes, const size_t alignment) {
+  reserved_bytes += bytes;
+  return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+}
+
+void SegmentArena::ReservedBytesCounter::do_deallocate(void* pointer, const size_t bytes, const size_t alignment) {
+  reserved_bytes -= bytes;
+  std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+}
+
+bool SegmentArena::ReservedBytesCounter::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+  return this == &other;
+}
+
+}  // namespace opossum
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>  // NOLINT(build/include_order)
+#include <utility>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Initial size of the arena of an encoded segment. Further buffers grow geometrically.
+constexpr size_t MIN_SEGMENT_ARENA_SIZE = 256;
+
+// Monotonic memory resource of an encoded segment. It counts the bytes of the buffers it reserves and the bytes it
+// hands out of them, so that the segment can report the unused rest of its buffers as part of its memory usage.
+class SegmentArena : public std::pmr::memory_resource {
+ public:
+  explicit SegmentArena(const size_t initial_size);
+
+  // returns the bytes that the arena reserved but did not hand out, e.g., the rest of its last buffer
+  size_t unused_bytes() const;
+
+ protected:
+  // upstream resource of the monotonic buffer, counts the bytes of the reserved buffers
+  class ReservedBytesCounter : public std::pmr::memory_resource {
+   public:
+    size_t reserved_bytes = 0;
+
+   protected:
+    void* do_allocate(const size_t bytes, const size_t alignment) final;
+    void do_deallocate(void* pointer, const size_t bytes, const size_t alignment) final;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept final;
+  };
+
+  void* do_allocate(const size_t bytes, const size_t alignment) final;
+  void do_deallocate(void* pointer, const size_t bytes, const size_t alignment) final;
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept final;
+
+  // The counter has to be declared first, so that it outlives the buffers, which are returned to it on destruction
+  ReservedBytesCounter _counter;
+  std::pmr::monotonic_buffer_resource _buffers;
+  size_t _allocated_bytes = 0;
+};
+
+// Allocator that shares the ownership of a segment arena. std::allocate_shared stores a copy of it in the control
+// block, so the arena lives as long as the object allocated with it. A default-constructed allocator has no arena and
+// allocates from the default memory resource.
+template <typename T>
+class ArenaAllocator {
+ public:
+  using value_type = T;
+
+  ArenaAllocator() = default;
+
+  explicit ArenaAllocator(std::shared_ptr<SegmentArena> arena) : _arena(std::move(arena)) {}
+
+  template <typename U>
+  ArenaAllocator(const ArenaAllocator<U>& other) : _arena(other.arena()) {}  // NOLINT(runtime/explicit)
+
+  T* allocate(const size_t count) { return static_cast<T*>(resource()->allocate(count * sizeof(T), alignof(T))); }
+
+  void deallocate(T* pointer, const size_t count) { resource()->deallocate(pointer, count * sizeof(T), alignof(T)); }
+
+  const std::shared_ptr<SegmentArena>& arena() const { return _arena; }
+
+  // returns the resource to allocate from, which a PolymorphicAllocator can use as well. Containers that are allocated
+  // with it do not own the arena, so they have to be owned by an object that was allocated with this allocator.
+  std::pmr::memory_resource* resource() const {
+    return _arena ? static_cast<std::pmr::memory_resource*>(_arena.get()) : std::pmr::get_default_resource();
+  }
+
+  template <typename U>
+  bool operator==(const ArenaAllocator<U>& other) const {
+    return resource() == other.resource();
+  }
+
+  template <typename U>
+  bool operator!=(const ArenaAllocator<U>& other) const {
+    return resource() != other.resource();
+  }
+
+ protected:
+  std::shared_ptr<SegmentArena> _arena;
+};
+
+// Creates an immutable segment whose buffers all come from one monotonic arena. Segment is constructed from args
+// followed by an ArenaAllocator of the arena. The segment object and its control block are placed in the arena as
+// well. Objects that the segment hands out, e.g., its dictionary, are allocated with the ArenaAllocator, so they share
+// the ownership of the arena and stay valid after the segment is gone. The arena is released as a whole when the last
+// of them is gone, e.g., after Table::compress_chunk replaced the chunk and no operator uses the segment anymore.
+template <typename Segment, typename... Args>
+std::shared_ptr<Segment> make_segment_in_arena(const size_t initial_size, Args&&... args) {
+  const auto arena = std::make_shared<SegmentArena>(std::max(initial_size, MIN_SEGMENT_ARENA_SIZE));
+  return std::allocate_shared<Segment>(ArenaAllocator<Segment>{arena}, std::forward<Args>(args)...,
+                                       ArenaAllocator<std::byte>{arena});
+}
+
+}  // namespace opossum
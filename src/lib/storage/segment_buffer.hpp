@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// Read-only array of an encoded segment, e.g., its value ids or its dictionary. The array either owns its elements in
+// a pmr_vector, which is the case for segments that are encoded in memory, or it references elements that are stored
+// elsewhere, e.g., in the mapping of a binary table file (see load_binary_table). A referencing buffer shares the
+// ownership of that storage, so the elements stay valid for as long as the buffer exists.
+template <typename T>
+class SegmentBuffer {
+ public:
+  using value_type = T;
+
+  SegmentBuffer() = default;
+
+  // takes over the elements of the vector
+  explicit SegmentBuffer(pmr_vector<T>&& values)
+      : _values(std::move(values)), _data(_values.data()), _size(_values.size()) {}
+
+  // references size elements at data, which have to stay valid as long as owner is alive
+  SegmentBuffer(const T* data, const size_t size, std::shared_ptr<const void> owner)
+      : _data(data), _size(size), _owner(std::move(owner)) {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable elements can be referenced");
+    DebugAssert(_owner, "A referencing buffer needs the owner of the elements");
+  }
+
+  // The element pointer of an owning buffer has to point into its own vector, which a copy allocates anew
+  SegmentBuffer(const SegmentBuffer& other) : _values(other._values), _owner(other._owner) { _adopt(other); }
+
+  SegmentBuffer(SegmentBuffer&& other) noexcept : _values(std::move(other._values)), _owner(std::move(other._owner)) {
+    _adopt(other);
+  }
+
+  // Assigning a pmr_vector keeps its previous allocator and would move the elements out of their arena
+  SegmentBuffer& operator=(const SegmentBuffer&) = delete;
+  SegmentBuffer& operator=(SegmentBuffer&&) = delete;
+
+  const T* data() const { return _data; }
+  size_t size() const { return _size; }
+  bool empty() const { return _size == 0; }
+
+  const T& operator[](const size_t index) const {
+    DebugAssert(index < _size, "There exists no element with the given index.");
+    return _data[index];
+  }
+
+  // same as operator[], but checks the index
+  const T& at(const size_t index) const {
+    if (index >= _size) throw std::out_of_range("There exists no element with the given index.");
+    return _data[index];
+  }
+
+  const T& front() const { return (*this)[0]; }
+  const T& back() const { return (*this)[_size - 1]; }
+
+  const T* begin() const { return _data; }
+  const T* end() const { return _data + _size; }
+  const T* cbegin() const { return _data; }
+  const T* cend() const { return _data + _size; }
+
+  // Returns the elements for writing, e.g., while an attribute vector is being filled. Only owning buffers are mutable.
+  T* mutable_data() {
+    DebugAssert(!_owner, "The elements of a referencing buffer are read-only");
+    return _values.data();
+  }
+
+  // returns whether the elements are stored elsewhere and only referenced
+  bool is_referencing() const { return static_cast<bool>(_owner); }
+
+  // returns the allocator of the owned elements
+  PolymorphicAllocator<T> get_allocator() const { return _values.get_allocator(); }
+
+  // returns the bytes of the owned vector's capacity or of the referenced elements
+  size_t element_memory_usage() const { return _owner ? _size * sizeof(T) : _values.capacity() * sizeof(T); }
+
+ protected:
+  void _adopt(const SegmentBuffer& other) {
+    _data = _owner ? other._data : _values.data();
+    _size = other._size;
+  }
+
+  pmr_vector<T> _values;
+  const T* _data = nullptr;
+  size_t _size = 0;
+  std::shared_ptr<const void> _owner;
+};
+
+// Counts the elements of a segment buffer like the heap buffer of a vector. Referenced elements count as well: the
+// pages of a mapping that a segment reads occupy memory just like a heap buffer would.
+template <typename T>
+size_t heap_memory_usage(const SegmentBuffer<T>& buffer) {
+  return buffer.element_memory_usage();
+}
+
+}  // namespace opossum
@@ -0,0 +1,193 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <type_traits>
+
+#include "base_segment.hpp"
+#include "bit_packed_attribute_vector.hpp"
+#include "fixed_size_attribute_vector.hpp"
+#include "frame_of_reference_segment.hpp"
+#include "reference_segment.hpp"
+#include "run_length_segment.hpp"
+#include "table.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+// dictionary_segment.hpp includes this file, so we cannot include it here
+template <typename T>
+class DictionarySegment;
+
+/**
+ * Typed access to the values of segments without going through the virtual BaseSegment::operator[], which returns
+ * every value as an AllTypeVariant. The segment type (and, for DictionarySegments, the attribute vector type) is
+ * resolved once per segment. The functor is then instantiated for that specific segment type and called with plain
+ * values of type T.
+ *
+ * Example:
+ *
+ *   resolve_data_type(table.column_type(column_id), [&](auto type) {
+ *     using Type = typename decltype(type)::type;
+ *     segment_iterate<Type>(*chunk.get_segment(column_id), [&](const Type& value, const ChunkOffset chunk_offset) {
+ *       ...
+ *     });
+ *   });
+ */
+
+namespace detail {
+
+// Calls the functor with the concrete type of the attribute vector
+template <typename Functor>
+void resolve_attribute_vector(const BaseAttributeVector& attribute_vector, const Functor& functor) {
+  if (const auto uint8_vector = dynamic_cast<const FixedSizeAttributeVector<uint8_t>*>(&attribute_vector)) {
+    functor(*uint8_vector);
+  } else if (const auto uint16_vector = dynamic_cast<const FixedSizeAttributeVector<uint16_t>*>(&attribute_vector)) {
+    functor(*uint16_vector);
+  } else if (const auto uint32_vector = dynamic_cast<const FixedSizeAttributeVector<uint32_t>*>(&attribute_vector)) {
+    functor(*uint32_vector);
+  } else if (const auto bit_packed_vector = dynamic_cast<const BitPackedAttributeVector*>(&attribute_vector)) {
+    functor(*bit_packed_vector);
+  } else {
+    Fail("Unknown attribute vector type");
+  }
+}
+
+// Calls the functor with all value ids of a FixedSizeAttributeVector and their positions
+template <typename ValueIDType, typename Functor>
+void value_ids_iterate(const FixedSizeAttributeVector<ValueIDType>& attribute_vector, const Functor& functor) {
+  const auto& value_ids = attribute_vector.values();
+  for (ChunkOffset chunk_offset{0}; chunk_offset < value_ids.size(); ++chunk_offset) {
+    functor(value_ids[chunk_offset], chunk_offset);
+  }
+}
+
+// Calls the functor with all value ids of a BitPackedAttributeVector and their positions. The value ids are decoded in
+// blocks, which is much faster than calling get() for each position.
+template <typename Functor>
+void value_ids_iterate(const BitPackedAttributeVector& attribute_vector, const Functor& functor) {
+  std::array<uint32_t, 1024> value_ids;
+  for (auto first_index = size_t{0}; first_index < attribute_vector.size(); first_index += value_ids.size()) {
+    const auto count = std::min(value_ids.size(), attribute_vector.size() - first_index);
+    attribute_vector.decode(first_index, count, value_ids.data());
+    for (auto index = size_t{0}; index < count; ++index) {
+      functor(value_ids[index], static_cast<ChunkOffset>(first_index + index));
+    }
+  }
+}
+
+// Returns a single value id without a virtual call
+template <typename ValueIDType>
+ValueIDType value_id_at(const FixedSizeAttributeVector<ValueIDType>& attribute_vector, const ChunkOffset chunk_offset) {
+  return attribute_vector.values()[chunk_offset];
+}
+
+inline ValueID value_id_at(const BitPackedAttributeVector& attribute_vector, const ChunkOffset chunk_offset) {
+  return attribute_vector.get(chunk_offset);
+}
+
+// Calls the functor with an accessor, i.e., a callable that returns the value of the given data segment at a chunk
+// offset. This is used for random accesses, e.g., when resolving the positions of a ReferenceSegment.
+template <typename T, typename Functor>
+void with_segment_accessor(const BaseSegment& segment, const Functor& functor) {
+  // FrameOfReferenceSegments only exist for integer types
+  if constexpr (std::is_integral_v<T>) {
+    if (const auto frame_of_reference_segment = dynamic_cast<const FrameOfReferenceSegment<T>*>(&segment)) {
+      functor([&](const ChunkOffset chunk_offset) { return frame_of_reference_segment->get(chunk_offset); });
+      return;
+    }
+  }
+
+  if (const auto value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+    const auto& values = value_segment->values();
+    functor([&values](const ChunkOffset chunk_offset) -> const T& { return values[chunk_offset]; });
+  } else if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    // Only few positions may be accessed, so front-coded dictionaries decode single values instead of all of them
+    const auto& dictionary = *dictionary_segment->dictionary();
+    resolve_attribute_vector(*dictionary_segment->attribute_vector(), [&](const auto& attribute_vector) {
+      functor([&](const ChunkOffset chunk_offset) -> T {
+        return dictionary[value_id_at(attribute_vector, chunk_offset)];
+      });
+    });
+  } else if (const auto run_length_segment = dynamic_cast<const RunLengthSegment<T>*>(&segment)) {
+    const auto& values = *run_length_segment->values();
+    const auto& end_positions = *run_length_segment->end_positions();
+    // Positions are often ascending, so the run of the previous access is checked before searching for the run
+    auto run_index = size_t{0};
+    functor([&](const ChunkOffset chunk_offset) -> const T& {
+      if (end_positions[run_index] < chunk_offset || (run_index > 0 && end_positions[run_index - 1] >= chunk_offset)) {
+        run_index = run_length_segment->run_index(chunk_offset);
+      }
+      return values[run_index];
+    });
+  } else {
+    Fail("ReferenceSegments can only reference ValueSegments and encoded segments");
+  }
+}
+
+}  // namespace detail
+
+// Calls functor(const T& value, const ChunkOffset chunk_offset) for every position of the segment, in order. NULL
+// positions of ReferenceSegments (see NULL_ROW_ID) are skipped.
+template <typename T, typename Functor>
+void segment_iterate(const BaseSegment& segment, const Functor& functor) {
+  // FrameOfReferenceSegments only exist for integer types. They are decoded block by block.
+  if constexpr (std::is_integral_v<T>) {
+    if (const auto frame_of_reference_segment = dynamic_cast<const FrameOfReferenceSegment<T>*>(&segment)) {
+      constexpr auto block_size = FrameOfReferenceSegment<T>::BLOCK_SIZE;
+      std::array<T, block_size> values;
+      const auto block_count = (frame_of_reference_segment->size() + block_size - 1) / block_size;
+      for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+        const auto count = frame_of_reference_segment->decode_block(block_index, values.data());
+        for (auto index = size_t{0}; index < count; ++index) {
+          functor(values[index], static_cast<ChunkOffset>(block_index * block_size + index));
+        }
+      }
+      return;
+    }
+  }
+
+  if (const auto value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+    const auto& values = value_segment->values();
+    const auto value_count = value_segment->size();
+    for (ChunkOffset chunk_offset{0}; chunk_offset < value_count; ++chunk_offset) {
+      functor(values[chunk_offset], chunk_offset);
+    }
+  } else if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    const auto decoded_dictionary = dictionary_segment->decoded_dictionary();
+    const auto& dictionary = *decoded_dictionary;
+    detail::resolve_attribute_vector(*dictionary_segment->attribute_vector(), [&](const auto& attribute_vector) {
+      detail::value_ids_iterate(attribute_vector, [&](const auto value_id, const ChunkOffset chunk_offset) {
+        functor(dictionary[value_id], chunk_offset);
+      });
+    });
+  } else if (const auto run_length_segment = dynamic_cast<const RunLengthSegment<T>*>(&segment)) {
+    const auto& values = *run_length_segment->values();
+    const auto& end_positions = *run_length_segment->end_positions();
+    auto chunk_offset = ChunkOffset{0};
+    for (auto run_index = size_t{0}; run_index < values.size(); ++run_index) {
+      for (; chunk_offset <= end_positions[run_index]; ++chunk_offset) functor(values[run_index], chunk_offset);
+    }
+  } else if (const auto reference_segment = dynamic_cast<const ReferenceSegment*>(&segment)) {
+    const auto& referenced_table = *reference_segment->referenced_table();
+    const auto referenced_column_id = reference_segment->referenced_column_id();
+
+    // Resolve the referenced segment once for each run of positions that point into the same chunk
+    reference_segment->pos_list()->for_each_chunk([&](const ChunkID chunk_id, const size_t begin_index,
+                                                      const size_t end_index, const auto& chunk_offset_at) {
+      const auto& referenced_segment = *referenced_table.get_chunk(chunk_id)->get_segment(referenced_column_id);
+      detail::with_segment_accessor<T>(referenced_segment, [&](const auto& accessor) {
+        for (auto index = begin_index; index < end_index; ++index) {
+          functor(accessor(chunk_offset_at(index)), static_cast<ChunkOffset>(index));
+        }
+      });
+    });
+  } else {
+    Fail("Unknown segment type");
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <optional>
+
+#include "all_type_variant.hpp"
+
+namespace opossum {
+
+// Zone map of a segment, i.e., the smallest and the largest of its values. Operators such as the TableScan use them to
+// skip chunks that cannot contain matching rows.
+struct SegmentStatistics {
+  AllTypeVariant min;
+  AllTypeVariant max;
+
+  // The number of distinct values is only known if it comes for free, e.g., from the dictionary of a DictionarySegment
+  std::optional<size_t> distinct_count;
+};
+
+}  // namespace opossum
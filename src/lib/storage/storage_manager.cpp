@@ -1,50 +1,159 @@
 #include "storage_manager.hpp"
 
+#include <atomic>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "bit_packed_attribute_vector.hpp"
+#include "dictionary_segment.hpp"
+#include "frame_of_reference_segment.hpp"
+#include "resolve_type.hpp"
+#include "run_length_segment.hpp"
 #include "utils/assert.hpp"
+#include "utils/binary_table.hpp"
+#include "utils/memory_usage.hpp"
+#include "value_segment.hpp"
 
 namespace opossum {
 
+namespace {
+
+// Returns the name of the segment's encoding, e.g., "Dictionary (BitPacked)"
+std::string encoding_name(const BaseSegment& segment, const std::string& column_type) {
+  auto name = std::string{"Reference"};
+  resolve_data_type(column_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    if constexpr (std::is_integral_v<Type>) {
+      if (dynamic_cast<const FrameOfReferenceSegment<Type>*>(&segment)) name = "FrameOfReference";
+    }
+    if (dynamic_cast<const ValueSegment<Type>*>(&segment)) {
+      name = "Value";
+    } else if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<Type>*>(&segment)) {
+      const auto& attribute_vector = *dictionary_segment->attribute_vector();
+      name = dynamic_cast<const BitPackedAttributeVector*>(&attribute_vector) ? "Dictionary (BitPacked)"
+                                                                               : "Dictionary (FixedSize)";
+    } else if (dynamic_cast<const RunLengthSegment<Type>*>(&segment)) {
+      name = "RunLength";
+    }
+  });
+  return name;
+}
+
+}  // namespace
+
 StorageManager& StorageManager::get() {
   static StorageManager instance;
   return instance;
 }
 
+template <typename Modifier>
+void StorageManager::_modify(const Modifier& modifier) {
+  std::lock_guard<std::mutex> lock(_write_mutex);
+  auto tables = std::make_shared<TableMap>(*std::atomic_load(&_tables));
+  modifier(*tables);
+  std::atomic_store(&_tables, std::shared_ptr<const TableMap>{std::move(tables)});
+  // The new map is stored first, so a reader that sees the new version also loads the new map
+  _version.fetch_add(1, std::memory_order_release);
+}
+
 void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> table) {
-  DebugAssert(!has_table(name), "There already exists a table with the given name.");
-  _tables.insert({name, table});
+  _modify([&](auto& tables) {
+    DebugAssert(!tables.count(name), "There already exists a table with the given name.");
+    tables.insert({name, table});
+  });
 }
 
 void StorageManager::drop_table(const std::string& name) {
-  if (!(has_table(name))) throw std::exception();
-  _tables.erase(name);
+  _modify([&](auto& tables) {
+    if (!tables.erase(name)) throw std::exception();
+  });
 }
 
-std::shared_ptr<Table> StorageManager::get_table(const std::string& name) const { return _tables.at(name); }
+std::shared_ptr<Table> StorageManager::get_table(const std::string& name) const { return snapshot()->at(name); }
 
-bool StorageManager::has_table(const std::string& name) const { return _tables.count(name); }
+bool StorageManager::has_table(const std::string& name) const { return snapshot()->count(name); }
 
 std::vector<std::string> StorageManager::table_names() const {
+  // A range-for over *snapshot() would release the snapshot before iterating over it
+  const auto tables = snapshot();
   std::vector<std::string> table_names;
-  for (const auto& _table : _tables) {
+  for (const auto& _table : *tables) {
     table_names.push_back(_table.first);
   }
   return table_names;
 }
 
+std::shared_ptr<const StorageManager::TableMap> StorageManager::snapshot() const {
+  // The StorageManager is a singleton, so one cached map per thread suffices
+  struct CachedSnapshot {
+    uint64_t version = 0;
+    std::shared_ptr<const TableMap> tables;
+  };
+  thread_local auto cached_snapshot = CachedSnapshot{};
+
+  const auto version = _version.load(std::memory_order_acquire);
+  if (!cached_snapshot.tables || cached_snapshot.version != version) {
+    // The loaded map may be even newer than version, in which case the next call loads it again
+    cached_snapshot.tables = std::atomic_load(&_tables);
+    cached_snapshot.version = version;
+  }
+  return cached_snapshot.tables;
+}
+
+void StorageManager::save_table(const std::string& name, const std::string& file_name) const {
+  get_table(name)->save(file_name);
+}
+
+void StorageManager::load_table(const std::string& name, const std::string& file_name) {
+  add_table(name, load_binary_table(file_name));
+}
+
+size_t StorageManager::estimate_memory_usage() const {
+  const auto tables = snapshot();
+  auto bytes = size_t{0};
+  for (const auto& [name, table] : *tables) bytes += table->estimate_memory_usage();
+  return bytes;
+}
+
 void StorageManager::print(std::ostream& out) const {
-  for (const auto& _table : _tables) {
+  const auto tables = snapshot();
+  for (const auto& _table : *tables) {
     const std::string table_name = _table.first;
     const std::shared_ptr<Table> table = _table.second;
     out << table_name << ", " << table->column_count() << ", " << table->row_count() << ", " << table->chunk_count();
-    out << std::endl;
+    out << ", " << table->estimate_memory_usage() << " bytes" << std::endl;
+
+    for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+      // bytes and number of segments per encoding
+      std::map<std::string, std::pair<size_t, size_t>> encodings;
+      auto column_bytes = size_t{0};
+      for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+        const auto segment = table->get_chunk(chunk_id)->get_segment(column_id);
+        const auto segment_bytes = SHARED_PTR_CONTROL_BLOCK_SIZE + segment->estimate_memory_usage();
+        auto& encoding = encodings[encoding_name(*segment, table->column_type(column_id))];
+        encoding.first += segment_bytes;
+        ++encoding.second;
+        column_bytes += segment_bytes;
+      }
+
+      out << "  " << table->column_name(column_id) << " (" << table->column_type(column_id) << "), " << column_bytes
+          << " bytes";
+      for (const auto& [name, encoding] : encodings) {
+        out << ", " << name << ": " << encoding.first << " bytes in " << encoding.second
+            << (encoding.second == 1 ? " segment" : " segments");
+      }
+      out << std::endl;
+    }
   }
 }
 
-void StorageManager::reset() { _tables.clear(); }
+void StorageManager::reset() {
+  _modify([](auto& tables) { tables.clear(); });
+}
 
 }  // namespace opossum
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <atomic>
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -13,8 +15,16 @@ namespace opossum {
 
 // The StorageManager is a singleton that maintains all tables
 // by mapping table names to table instances.
+//
+// Query threads look up tables on every request, so readers must not contend for a lock. The catalog is therefore an
+// immutable map that writers copy, modify, and swap atomically. Writers are serialized by a mutex. Each thread caches
+// the map it loaded last together with the catalog version, so a reader only compares the version and copies the
+// cached pointer, which takes no lock, as long as the catalog does not change. A dropped table stays alive as long as a
+// query or a snapshot still references it, which includes the cached map of a thread until that thread reads again.
 class StorageManager : private Noncopyable {
  public:
+  using TableMap = std::map<std::string, std::shared_ptr<Table>>;
+
   static StorageManager& get();
 
   // adds a table to the storage manager
@@ -32,7 +42,20 @@ class StorageManager : private Noncopyable {
   // returns a list of all table names
   std::vector<std::string> table_names() const;
 
-  // prints information about all tables in the storage manager (name, #columns, #rows, #chunks)
+  // returns the current catalog, which is not affected by later changes
+  std::shared_ptr<const TableMap> snapshot() const;
+
+  // writes the table with the given name into a binary file, see save_binary_table
+  void save_table(const std::string& name, const std::string& file_name) const;
+
+  // loads a table from a binary file written by save_table and adds it with the given name
+  void load_table(const std::string& name, const std::string& file_name);
+
+  // returns the bytes of all tables, see Table::estimate_memory_usage
+  size_t estimate_memory_usage() const;
+
+  // Prints information about all tables in the storage manager (name, #columns, #rows, #chunks, bytes). For each
+  // column, the bytes of its segments are broken down by their encoding.
   void print(std::ostream& out = std::cout) const;
 
   // deletes the entire StorageManager and creates a new one, used especially in tests
@@ -42,7 +65,15 @@ class StorageManager : private Noncopyable {
 
  protected:
   StorageManager() {}
-  StorageManager& operator=(StorageManager&&) = default;
-  std::map<std::string, std::shared_ptr<Table>> _tables;
+
+  // copies the current catalog, lets the modifier change the copy, and publishes it
+  template <typename Modifier>
+  void _modify(const Modifier& modifier);
+
+  // only accessed through std::atomic_load and std::atomic_store
+  std::shared_ptr<const TableMap> _tables = std::make_shared<TableMap>();
+  // incremented after each change of _tables, tells readers whether their cached map is outdated
+  std::atomic<uint64_t> _version{0};
+  std::mutex _write_mutex;
 };
 }  // namespace opossum
@@ -1,24 +1,67 @@
 #include "table.hpp"
 
 #include <algorithm>
+#include <chrono>
+#include <functional>
 #include <iomanip>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <numeric>
 #include <string>
-#include <thread>
+#include <type_traits>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "value_segment.hpp"
 
 #include "dictionary_segment.hpp"
+#include "frame_of_reference_segment.hpp"
 #include "resolve_type.hpp"
+#include "run_length_segment.hpp"
+#include "scheduler/worker_pool.hpp"
+#include "segment_arena.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/binary_table.hpp"
+#include "utils/memory_usage.hpp"
 
 namespace opossum {
 
+namespace {
+
+// Preallocating larger chunks for concurrent appends would take too much memory
+constexpr auto MAX_PREALLOCATED_CHUNK_SIZE = uint32_t{1} << 24;
+
+template <typename T>
+std::shared_ptr<BaseSegment> encode_segment(const std::shared_ptr<BaseSegment>& segment,
+                                            const SegmentEncodingSpec& encoding_spec) {
+  // Encoded segments are immutable, so each of them gets a monotonic arena that is freed as a whole together with the
+  // segment. The first buffer of the arena only holds the segment object and its small buffers. Buffers that do not
+  // fit into the arena's next buffer, e.g., the value ids of a large chunk, get an upstream buffer of their exact
+  // size, so a larger first buffer would only add unused bytes to the memory usage of the segment.
+  const auto arena_size = MIN_SEGMENT_ARENA_SIZE;
+
+  switch (encoding_spec.encoding) {
+    case SegmentEncoding::Dictionary:
+      break;
+    case SegmentEncoding::RunLength:
+      return make_segment_in_arena<RunLengthSegment<T>>(arena_size, segment);
+    case SegmentEncoding::FrameOfReference:
+      // Only integer columns whose blocks have narrow enough value ranges can be frame-of-reference encoded
+      if constexpr (std::is_integral_v<T>) {
+        if (FrameOfReferenceSegment<T>::can_encode(*segment)) {
+          return make_segment_in_arena<FrameOfReferenceSegment<T>>(arena_size, segment);
+        }
+      }
+      break;
+  }
+  return make_segment_in_arena<DictionarySegment<T>>(arena_size, segment, encoding_spec.attribute_vector_encoding);
+}
+
+}  // namespace
+
 Table::Table(uint32_t chunk_size) {
   _maximum_chunk_size = chunk_size;
   // Automatically create the first chunk when creating a Table
@@ -27,15 +70,15 @@ Table::Table(uint32_t chunk_size) {
 }
 
 void Table::add_column_definition(const std::string& name, const std::string& type) {
-  // Implementation goes here
+  _column_names.push_back(name);
+  _column_types.push_back(type);
 }
 
 void Table::add_column(const std::string& name, const std::string& type) {
   DebugAssert(row_count() == 0, "You can't add columns to tables that already contain entries.");
 
   // Store the name and type of the to-be-added column
-  _column_names.push_back(name);
-  _column_types.push_back(type);
+  add_column_definition(name, type);
 
   // Add a ValueSegment for the new column to each of the chunks
   for (auto chunk_index = ChunkID{0}; chunk_index < _chunks.size(); chunk_index++) {
@@ -45,28 +88,140 @@ void Table::add_column(const std::string& name, const std::string& type) {
 }
 
 void Table::append(const std::vector<AllTypeVariant> values) {
+  // Preallocated chunks only accept rows through append_concurrently
+  if (_last_chunk()->is_preallocated()) {
+    append_concurrently(values);
+    return;
+  }
+
   // Get the last "free" chunk while potentially creating a new one if the last one is full
-  std::shared_ptr<Chunk> last_chunk = _chunks.back();
-  if (last_chunk->size() == _maximum_chunk_size) {
-    auto new_chunk = std::make_shared<Chunk>();
-    for (auto const& column_type : _column_types) {
-      new_chunk->add_segment(make_shared_by_data_type<BaseSegment, ValueSegment>(column_type));
+  if (_last_chunk()->size() == _maximum_chunk_size) create_new_chunk();
+
+  // Append the to-be-appended values to the last chunk
+  const auto chunk = _last_chunk();
+  chunk->append(values);
+
+  // Full chunks do not receive further rows, so their zone maps stay valid
+  if (chunk->size() == _maximum_chunk_size) _seal_chunk(chunk);
+}
+
+void Table::append_concurrently(const std::vector<AllTypeVariant>& values) {
+  Assert(_maximum_chunk_size <= MAX_PREALLOCATED_CHUNK_SIZE,
+         "Concurrent appends need a maximum chunk size that can be preallocated.");
+  DebugAssert(values.size() == column_count(), "The number of passed values doesn't match the number of columns.");
+
+  while (true) {
+    const auto chunk = _last_chunk();
+    const auto chunk_offset = chunk->reserve_row();
+    if (!chunk_offset) {
+      // The last chunk is full (or not preallocated), so a new one is added, either by this thread or another one
+      _add_preallocated_chunk(chunk);
+      continue;
     }
-    _chunks.push_back(new_chunk);
-    last_chunk = new_chunk;
+
+    for (auto column_id = ColumnID{0}; column_id < column_count(); ++column_id) {
+      resolve_data_type(_column_types[column_id], [&](auto type) {
+        using Type = typename decltype(type)::type;
+        std::static_pointer_cast<ValueSegment<Type>>(chunk->get_segment(column_id))
+            ->set(*chunk_offset, values[column_id]);
+      });
+    }
+    chunk->publish_row(*chunk_offset);
+
+    // Rows are published in order, so all rows of the chunk are complete once its last row is published
+    if (*chunk_offset + 1 == chunk->capacity()) _seal_chunk(chunk);
+    return;
   }
+}
 
-  // Append the to-be-appended values to the last chunk
-  last_chunk->append(values);
+void Table::append_columns(std::vector<AllTypeVector> columns) {
+  Assert(columns.size() == column_count(), "The number of passed columns doesn't match the number of columns.");
+  if (columns.empty()) return;
+
+  const auto value_vector_size = [](const auto& values) { return values.size(); };
+  const auto row_count = boost::apply_visitor(value_vector_size, columns[0]);
+  for (auto column_id = ColumnID{0}; column_id < column_count(); ++column_id) {
+    Assert(boost::apply_visitor(value_vector_size, columns[column_id]) == row_count,
+           "All columns have to hold the same number of values.");
+    resolve_data_type(_column_types[column_id], [&](auto type) {
+      using Type = typename decltype(type)::type;
+      Assert(boost::get<std::vector<Type>>(&columns[column_id]), "The values do not match the column's type.");
+    });
+  }
+
+  // Preallocated chunks only accept rows through append_concurrently, so the columns go into a new chunk
+  if (_last_chunk()->is_preallocated()) create_new_chunk();
+
+  auto first_row = size_t{0};
+  while (first_row < row_count) {
+    if (_last_chunk()->size() == _maximum_chunk_size) create_new_chunk();
+    const auto chunk = _last_chunk();
+    // Like append, a maximum chunk size of 0 only keeps rows out of the empty first chunk and does not limit the others
+    const auto chunk_row_count = _maximum_chunk_size == 0
+                                     ? row_count - first_row
+                                     : std::min(row_count - first_row, size_t{_maximum_chunk_size - chunk->size()});
+
+    // If all rows fit into the chunk, the vectors are moved as a whole. Otherwise, the rows are moved into one
+    // correctly sized vector per chunk.
+    std::vector<AllTypeVector> chunk_columns;
+    chunk_columns.reserve(columns.size());
+    for (auto& column : columns) {
+      boost::apply_visitor(
+          [&](auto& values) {
+            using Values = std::decay_t<decltype(values)>;
+            if (chunk_row_count == row_count) {
+              chunk_columns.emplace_back(std::move(values));
+            } else {
+              const auto first = values.begin() + static_cast<std::ptrdiff_t>(first_row);
+              chunk_columns.emplace_back(Values(std::make_move_iterator(first),
+                                                std::make_move_iterator(first + chunk_row_count)));
+            }
+          },
+          column);
+    }
+
+    chunk->append_columns(std::move(chunk_columns));
+    if (chunk->size() == _maximum_chunk_size) _seal_chunk(chunk);
+    first_row += chunk_row_count;
+  }
 }
 
 void Table::create_new_chunk() {
-  // Implementation goes here
+  auto new_chunk = std::make_shared<Chunk>();
+  for (auto const& column_type : _column_types) {
+    new_chunk->add_segment(make_shared_by_data_type<BaseSegment, ValueSegment>(column_type));
+  }
+  std::unique_lock<std::shared_mutex> lock(*_chunks_mutex);
+  _chunks.push_back(new_chunk);
+}
+
+std::shared_ptr<Chunk> Table::_last_chunk() const {
+  std::shared_lock<std::shared_mutex> lock(*_chunks_mutex);
+  return _chunks.back();
+}
+
+void Table::_add_preallocated_chunk(const std::shared_ptr<Chunk>& full_chunk) {
+  std::unique_lock<std::shared_mutex> lock(*_chunks_mutex);
+  if (_chunks.back() != full_chunk) return;
+
+  auto new_chunk = std::make_shared<Chunk>(_maximum_chunk_size);
+  for (const auto& column_type : _column_types) {
+    new_chunk->add_segment(make_shared_by_data_type<BaseSegment, ValueSegment>(column_type, _maximum_chunk_size,
+                                                                              new_chunk->published_size()));
+  }
+
+  // An empty chunk that only accepts appends from a single thread (e.g., the initial one) is replaced
+  if (!full_chunk->is_preallocated() && full_chunk->size() == 0) {
+    _chunks.back() = new_chunk;
+  } else {
+    _chunks.push_back(new_chunk);
+  }
 }
 
 uint16_t Table::column_count() const { return _column_names.size(); }
 
 uint64_t Table::row_count() const {
+  std::shared_lock<std::shared_mutex> lock(*_chunks_mutex);
   uint64_t row_count = 0;
   for (auto chunk_index = ChunkID{0}; chunk_index < _chunks.size(); chunk_index++) {
     row_count += _chunks[chunk_index]->size();
@@ -74,7 +229,23 @@ uint64_t Table::row_count() const {
   return row_count;
 }
 
-ChunkID Table::chunk_count() const { return ChunkID{_chunks.size()}; }
+size_t Table::estimate_memory_usage() const {
+  auto bytes = sizeof(*this) + sizeof(std::shared_mutex) + SHARED_PTR_CONTROL_BLOCK_SIZE + sizeof(PendingCompressions) +
+               heap_memory_usage(_column_names) + heap_memory_usage(_column_types);
+  std::shared_lock<std::shared_mutex> lock(*_chunks_mutex);
+  bytes += heap_memory_usage(_chunks);
+  // Position lists are counted once per table, even if several chunks share them
+  std::unordered_set<const PosList*> counted_pos_lists;
+  for (const auto& chunk : _chunks) {
+    bytes += SHARED_PTR_CONTROL_BLOCK_SIZE + chunk->estimate_memory_usage(counted_pos_lists);
+  }
+  return bytes;
+}
+
+ChunkID Table::chunk_count() const {
+  std::shared_lock<std::shared_mutex> lock(*_chunks_mutex);
+  return ChunkID{_chunks.size()};
+}
 
 ColumnID Table::column_id_by_name(const std::string& column_name) const {
   auto iterator = std::find(_column_names.begin(), _column_names.end(), column_name);
@@ -96,53 +267,136 @@ const std::string& Table::column_type(ColumnID column_id) const {
   return _column_types[column_id];
 }
 
-Chunk& Table::get_chunk(ChunkID chunk_id) { return *_chunks[chunk_id]; }
-
-const Chunk& Table::get_chunk(ChunkID chunk_id) const { return *_chunks[chunk_id]; }
+std::shared_ptr<Chunk> Table::get_chunk(ChunkID chunk_id) {
+  std::shared_lock<std::shared_mutex> lock(*_chunks_mutex);
+  return _chunks[chunk_id];
+}
 
-std::mutex chunk_access_mutex;
+std::shared_ptr<const Chunk> Table::get_chunk(ChunkID chunk_id) const {
+  std::shared_lock<std::shared_mutex> lock(*_chunks_mutex);
+  return _chunks[chunk_id];
+}
 
-void Table::compress_chunk(ChunkID chunk_id) {
-  auto new_chunk = std::make_shared<Chunk>();
-  auto old_chunk = _chunks.at(chunk_id);
+void Table::compress_chunk(ChunkID chunk_id, const SegmentEncodingSpec& encoding_spec) {
+  compress_chunks(chunk_id, ChunkID{chunk_id + 1}, encoding_spec);
+}
 
-  std::vector<std::thread> threads(old_chunk->column_count());
-  std::vector<std::shared_ptr<BaseSegment>> compressed_segments(old_chunk->column_count());
+std::chrono::nanoseconds Table::compress_chunks(ChunkID first_chunk_id, ChunkID last_chunk_id,
+                                                const SegmentEncodingSpec& encoding_spec) {
+  DebugAssert(first_chunk_id <= last_chunk_id && last_chunk_id <= chunk_count(), "Invalid range of chunks.");
+  const auto start_time = std::chrono::steady_clock::now();
+
+  // Holds the compressed segments of each chunk in the range. Each job writes exactly one of them. Chunks that are
+  // skipped keep an empty vector.
+  std::vector<std::vector<std::shared_ptr<BaseSegment>>> compressed_segments(last_chunk_id - first_chunk_id);
+  std::vector<std::shared_ptr<Chunk>> old_chunks(last_chunk_id - first_chunk_id);
+
+  // Create one job per (chunk, column) pair so that even few, wide chunks or many, narrow chunks use all workers
+  std::vector<std::function<void()>> jobs;
+  for (auto chunk_id = first_chunk_id; chunk_id < last_chunk_id; ++chunk_id) {
+    const auto old_chunk = get_chunk(chunk_id);
+    // Rows that append_concurrently has reserved but not yet published would be missing from the compressed chunk.
+    // Such a chunk is compressed by _seal_chunk once it is full, if background compression is enabled.
+    if (old_chunk->is_preallocated() && old_chunk->size() < old_chunk->capacity()) continue;
+    old_chunks[chunk_id - first_chunk_id] = old_chunk;
+    auto& chunk_segments = compressed_segments[chunk_id - first_chunk_id];
+    chunk_segments.resize(old_chunk->column_count());
+
+    for (auto column_id = ColumnID{0}; column_id < old_chunk->column_count(); ++column_id) {
+      jobs.emplace_back([&, old_chunk, column_id]() {
+        const auto segment = old_chunk->get_segment(column_id);
+        resolve_data_type(column_type(column_id), [&](auto type) {
+          using Type = typename decltype(type)::type;
+          // Segments that are already compressed are not touched
+          if (std::dynamic_pointer_cast<ValueSegment<Type>>(segment)) {
+            chunk_segments[column_id] = encode_segment<Type>(segment, encoding_spec);
+          } else {
+            chunk_segments[column_id] = segment;
+          }
+        });
+      });
+    }
+  }
 
-  // Lambda function which compresses a given uncompressed segment (with a given type) and writes the output to the
-  // given position in the compressed_segments vector
-  auto compress_segment = [&compressed_segments](const std::string& column_type,
-                                                 const std::shared_ptr<BaseSegment>& uncompressed_segment,
-                                                 const ColumnID& segment_index) {
-    compressed_segments[segment_index] =
-        make_shared_by_data_type<BaseSegment, DictionarySegment>(column_type, uncompressed_segment);
-  };
+  WorkerPool::get().run_and_wait(jobs);
 
-  // Start one thread for each of the segments in order to compress it
-  for (auto segment_index = ColumnID{0}; segment_index < old_chunk->column_count(); segment_index++) {
-    threads[segment_index] =
-        std::thread(compress_segment, column_type(segment_index), old_chunk->get_segment(segment_index), segment_index);
+  // Replace the old, potentially uncompressed chunks with the new chunks (containing all compressed segments). The
+  // zone maps are computed before the new chunks become visible, so readers never see them change.
+  std::vector<std::shared_ptr<Chunk>> new_chunks(last_chunk_id - first_chunk_id);
+  for (auto chunk_id = first_chunk_id; chunk_id < last_chunk_id; ++chunk_id) {
+    if (!old_chunks[chunk_id - first_chunk_id]) continue;
+    auto new_chunk = std::make_shared<Chunk>();
+    for (const auto& segment : compressed_segments[chunk_id - first_chunk_id]) new_chunk->add_segment(segment);
+    new_chunk->compute_statistics();
+    new_chunks[chunk_id - first_chunk_id] = new_chunk;
   }
 
-  // Wait for all compression threads to finish and add their output (from the compressed_segments vector)
-  // to the new chunk
-  for (auto thread_index = ColumnID{0}; thread_index < threads.size(); thread_index++) {
-    threads[thread_index].join();
-    new_chunk->add_segment(compressed_segments[thread_index]);
+  // Prevent the _chunks vector from concurrent access
+  std::unique_lock<std::shared_mutex> lock(*_chunks_mutex);
+  for (auto chunk_id = first_chunk_id; chunk_id < last_chunk_id; ++chunk_id) {
+    // In the meantime, an empty first chunk may have been replaced by a preallocated one (see _add_preallocated_chunk),
+    // which must not be overwritten. Readers that still hold the old chunk (see get_chunk) keep it alive.
+    if (new_chunks[chunk_id - first_chunk_id] && _chunks[chunk_id] == old_chunks[chunk_id - first_chunk_id]) {
+      _chunks[chunk_id] = new_chunks[chunk_id - first_chunk_id];
+    }
   }
 
-  // Prevent the _chunks vector from concurrent access
-  chunk_access_mutex.lock();
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_time);
+}
+
+std::chrono::nanoseconds Table::compress_table(const SegmentEncodingSpec& encoding_spec) {
+  return compress_chunks(ChunkID{0}, chunk_count(), encoding_spec);
+}
+
+void Table::enable_background_compression(const SegmentEncodingSpec& encoding_spec) {
+  _background_compression = encoding_spec;
+}
+
+void Table::disable_background_compression() { _background_compression.reset(); }
 
-  // Replace the old, potentially uncompressed chunk with the new chunk (containing all compressed segments)
-  _chunks[chunk_id] = new_chunk;
+void Table::wait_for_background_compression() const {
+  std::unique_lock<std::mutex> lock(_pending_compressions->mutex);
+  _pending_compressions->all_done.wait(lock, [&]() { return _pending_compressions->count == 0; });
+}
+
+void Table::_seal_chunk(const std::shared_ptr<Chunk>& chunk) {
+  chunk->compute_statistics();
+  if (!_background_compression) return;
+
+  {
+    std::lock_guard<std::mutex> lock(_pending_compressions->mutex);
+    ++_pending_compressions->count;
+  }
 
-  // Release mutex to free resource
-  chunk_access_mutex.unlock();
+  // The job only holds the chunk, not the table. The zone maps computed above stay valid for the compressed segments.
+  WorkerPool::get().schedule([chunk, column_types = _column_types, encoding_spec = *_background_compression,
+                              pending_compressions = _pending_compressions]() {
+    for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+      const auto segment = chunk->get_segment(column_id);
+      resolve_data_type(column_types[column_id], [&](auto type) {
+        using Type = typename decltype(type)::type;
+        if (std::dynamic_pointer_cast<ValueSegment<Type>>(segment)) {
+          chunk->replace_segment(column_id, encode_segment<Type>(segment, encoding_spec));
+        }
+      });
+    }
+
+    std::lock_guard<std::mutex> lock(pending_compressions->mutex);
+    if (--pending_compressions->count == 0) pending_compressions->all_done.notify_all();
+  });
 }
 
-void emplace_chunk(Chunk chunk) {
-  // Implementation goes here
+void Table::emplace_chunk(Chunk chunk) {
+  std::unique_lock<std::shared_mutex> lock(*_chunks_mutex);
+  // The first chunk is created together with the table. Operators that build their output chunk by chunk (e.g.,
+  // TableScan) replace it instead of leaving an empty chunk at the front of the table.
+  if (_chunks.size() == 1 && _chunks.front()->size() == 0) {
+    _chunks.front() = std::make_shared<Chunk>(std::move(chunk));
+  } else {
+    _chunks.push_back(std::make_shared<Chunk>(std::move(chunk)));
+  }
 }
 
+void Table::save(const std::string& file_name) const { save_binary_table(*this, file_name); }
+
 }  // namespace opossum
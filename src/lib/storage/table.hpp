@@ -1,9 +1,15 @@
 #pragma once
 
+// the linter wants this to be above everything else
+#include <shared_mutex>
+
+#include <chrono>
+#include <condition_variable>
 #include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -43,9 +49,10 @@ class Table : private Noncopyable {
   // returns the number of chunks (cannot exceed ChunkID (uint32_t))
   ChunkID chunk_count() const;
 
-  // returns the chunk with the given id
-  Chunk& get_chunk(ChunkID chunk_id);
-  const Chunk& get_chunk(ChunkID chunk_id) const;
+  // Returns the chunk with the given id. The table may replace the chunk, e.g., with a compressed version of it, while
+  // the caller still uses it. The pointer shares the ownership of the chunk, so it stays valid until it is released.
+  std::shared_ptr<Chunk> get_chunk(ChunkID chunk_id);
+  std::shared_ptr<const Chunk> get_chunk(ChunkID chunk_id) const;
 
   // Adds a chunk to the table. If the first chunk is empty, it is replaced.
   void emplace_chunk(Chunk chunk);
@@ -78,19 +85,81 @@ class Table : private Noncopyable {
   void add_column(const std::string& name, const std::string& type);
 
   // inserts a row at the end of the table
-  // note this is slow and not thread-safe and should be used for testing purposes only
+  // note this is slow and not thread-safe and should be used for testing purposes only, see append_concurrently
   void append(std::vector<AllTypeVariant> values);
 
+  // Inserts a row at the end of the table and may be called by many threads at once. Each row atomically reserves a
+  // slot in the last chunk, whose segments are preallocated with max_chunk_size slots, so appends never reallocate.
+  // Readers see the row (e.g., in row_count() and Chunk::size()) once all its values are written. Rows of concurrent
+  // calls are inserted in an unspecified order. The table needs a maximum chunk size that can be preallocated.
+  void append_concurrently(const std::vector<AllTypeVariant>& values);
+
+  // Appends the values of all columns at once, i.e., one vector of values per column. All vectors have to hold the same
+  // number of values and match the types of the columns. The rows fill up the last chunk and new chunks as needed.
+  // The values are moved into the ValueSegments, so pass the vectors with std::move to avoid copying them.
+  void append_columns(std::vector<AllTypeVector> columns);
+
   // creates a new chunk and appends it
   void create_new_chunk();
 
-  // compresses a ValueSegment into a DictionarySegment
-  void compress_chunk(ChunkID chunk_id);
+  // compresses the ValueSegments of a chunk into the segment type chosen by the encoding spec (DictionarySegments by
+  // default), segments that are already encoded are kept
+  // the attribute vector encoding of the spec determines how DictionarySegments store their value ids
+  void compress_chunk(ChunkID chunk_id, const SegmentEncodingSpec& encoding_spec = SegmentEncodingSpec{});
+
+  // compresses all segments of the chunks in [first_chunk_id, last_chunk_id), see compress_chunk
+  // the (chunk, column) pairs are compressed in parallel on the WorkerPool, the return value is the time this took
+  // preallocated chunks that are not full yet are skipped, as append_concurrently may still write into them
+  std::chrono::nanoseconds compress_chunks(ChunkID first_chunk_id, ChunkID last_chunk_id,
+                                           const SegmentEncodingSpec& encoding_spec = SegmentEncodingSpec{});
+
+  // compresses all chunks of the table, see compress_chunks
+  std::chrono::nanoseconds compress_table(const SegmentEncodingSpec& encoding_spec = SegmentEncodingSpec{});
+
+  // Once enabled, every chunk that becomes full through append or append_columns is compressed in the background on
+  // the WorkerPool, using the given encoding spec. The compressed segments are swapped into the chunk one by one (see
+  // Chunk::replace_segment), so neither appenders nor concurrent readers of the chunk are blocked.
+  void enable_background_compression(const SegmentEncodingSpec& encoding_spec = SegmentEncodingSpec{});
+
+  // stops queueing full chunks for background compression, chunks that are already queued are still compressed
+  void disable_background_compression();
+
+  // blocks until all chunks that have been queued for background compression are compressed
+  void wait_for_background_compression() const;
+
+  // returns the bytes of the table including all its chunks, see Chunk::estimate_memory_usage. A position list that is
+  // shared by several chunks is counted once.
+  size_t estimate_memory_usage() const;
+
+  // writes the table into a binary file that can be loaded much faster than a .tbl file, see save_binary_table
+  void save(const std::string& file_name) const;
 
  protected:
+  // returns the last chunk, which receives appended rows
+  std::shared_ptr<Chunk> _last_chunk() const;
+
+  // Adds a preallocated chunk unless another thread already replaced the full chunk. An empty first chunk is replaced.
+  void _add_preallocated_chunk(const std::shared_ptr<Chunk>& full_chunk);
+
+  // Called once the last chunk is full. Computes its zone maps and queues it for background compression if enabled.
+  void _seal_chunk(const std::shared_ptr<Chunk>& chunk);
+
+  // Counts the chunks that are queued for background compression. It is shared with the compression jobs, which thus
+  // never access the table itself and stay valid if the table is moved or destroyed before they finish.
+  struct PendingCompressions {
+    std::mutex mutex;
+    std::condition_variable all_done;
+    size_t count = 0;
+  };
+
   std::vector<std::shared_ptr<Chunk>> _chunks;
+  // Guards the _chunks vector itself, e.g., against a reallocation while another thread looks up a chunk. The chunks
+  // are not guarded by it.
+  std::unique_ptr<std::shared_mutex> _chunks_mutex = std::make_unique<std::shared_mutex>();
   uint32_t _maximum_chunk_size;
   std::vector<std::string> _column_names;
   std::vector<std::string> _column_types;
+  std::optional<SegmentEncodingSpec> _background_compression;
+  std::shared_ptr<PendingCompressions> _pending_compressions = std::make_shared<PendingCompressions>();
 };
 }  // namespace opossum
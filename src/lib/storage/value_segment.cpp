@@ -1,5 +1,7 @@
 #include "value_segment.hpp"
 
+#include <algorithm>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <sstream>
@@ -10,24 +12,52 @@
 #include "type_cast.hpp"
 #include "utils/assert.hpp"
 #include "utils/performance_warning.hpp"
+#include "utils/memory_usage.hpp"
 
 namespace opossum {
 
+template <typename T>
+ValueSegment<T>::ValueSegment(std::vector<T>&& values) : _values(std::move(values)) {}
+
+template <typename T>
+ValueSegment<T>::ValueSegment(const ChunkOffset capacity,
+                              std::shared_ptr<const std::atomic<ChunkOffset>> published_size)
+    : _values(capacity), _published_size(std::move(published_size)) {}
+
 template <typename T>
 AllTypeVariant ValueSegment<T>::operator[](const ChunkOffset chunk_offset) const {
   PerformanceWarning("operator[] used");
-  DebugAssert(chunk_offset < _values.size(), "There exists no value with the given position.");
+  DebugAssert(chunk_offset < size(), "There exists no value with the given position.");
   return _values[chunk_offset];
 }
 
 template <typename T>
 void ValueSegment<T>::append(const AllTypeVariant& val) {
+  Assert(!_published_size, "Preallocated segments can only be written with set().");
   _values.push_back(type_cast<T>(val));
 }
 
+template <typename T>
+void ValueSegment<T>::append_values(std::vector<T>&& values) {
+  Assert(!_published_size, "Preallocated segments can only be written with set().");
+  if (_values.empty()) {
+    _values = std::move(values);
+  } else {
+    _values.insert(_values.end(), std::make_move_iterator(values.begin()), std::make_move_iterator(values.end()));
+  }
+}
+
+template <typename T>
+void ValueSegment<T>::set(const ChunkOffset chunk_offset, const AllTypeVariant& value) {
+  DebugAssert(_published_size, "Only preallocated segments can be written with set().");
+  DebugAssert(chunk_offset < _values.size(), "There exists no slot with the given position.");
+  _values[chunk_offset] = type_cast<T>(value);
+}
+
 template <typename T>
 size_t ValueSegment<T>::size() const {
-  return _values.size();
+  // The acquire load makes the values of all published rows visible to this thread
+  return _published_size ? _published_size->load(std::memory_order_acquire) : _values.size();
 }
 
 template <typename T>
@@ -37,7 +67,15 @@ const std::vector<T>& ValueSegment<T>::values() const {
 
 template <typename T>
 size_t ValueSegment<T>::estimate_memory_usage() const {
-  return size() * sizeof(T);
+  return sizeof(*this) + heap_memory_usage(_values);
+}
+
+template <typename T>
+std::shared_ptr<const SegmentStatistics> ValueSegment<T>::compute_statistics() const {
+  const auto value_count = size();
+  if (value_count == 0) return nullptr;
+  const auto min_max = std::minmax_element(_values.cbegin(), _values.cbegin() + value_count);
+  return std::make_shared<SegmentStatistics>(SegmentStatistics{*min_max.first, *min_max.second, std::nullopt});
 }
 
 EXPLICITLY_INSTANTIATE_DATA_TYPES(ValueSegment);
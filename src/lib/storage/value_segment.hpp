@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <utility>
@@ -13,25 +14,49 @@ namespace opossum {
 template <typename T>
 class ValueSegment : public BaseSegment {
  public:
+  ValueSegment() = default;
+
+  // creates a segment that holds the given values, e.g., when loading a table from a file
+  explicit ValueSegment(std::vector<T>&& values);
+
+  // Creates a segment with capacity preallocated slots for concurrent appends (see Table::append_concurrently). The
+  // slots are written with set() and never reallocated. Only the first published_size values are visible, the counter
+  // is shared by all segments of a chunk.
+  ValueSegment(const ChunkOffset capacity, std::shared_ptr<const std::atomic<ChunkOffset>> published_size);
+
   // return the value at a certain position. If you want to write efficient operators, back off!
   AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
 
   // add a value to the end
   void append(const AllTypeVariant& val) final;
 
+  // adds all values to the end at once, the values are moved into the segment
+  void append_values(std::vector<T>&& values);
+
+  // writes a value into a preallocated slot, different slots may be written concurrently
+  void set(const ChunkOffset chunk_offset, const AllTypeVariant& value);
+
   // return the number of entries
   size_t size() const final;
 
   // Return all values. This is the preferred method to check a value at a certain index. Usually you need to
   // access more than a single value anyway.
   // e.g. const auto& values = value_segment.values(); and then: values[i]; in your loop.
+  // For preallocated segments, the vector holds all slots, but only the first size() values are valid. Always use
+  // size() as the bound of your loop.
   const std::vector<T>& values() const;
 
   // returns the calculated memory usage
   size_t estimate_memory_usage() const final;
 
+  // finds the smallest and the largest value in a single pass, the number of distinct values is not computed
+  std::shared_ptr<const SegmentStatistics> compute_statistics() const final;
+
  protected:
   std::vector<T> _values;
+
+  // only set for preallocated segments
+  std::shared_ptr<const std::atomic<ChunkOffset>> _published_size;
 };
 
 }  // namespace opossum
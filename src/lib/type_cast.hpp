@@ -34,11 +34,13 @@ const T& get(const AllTypeVariant& value) {
 }
 
 // cast methods - from variant to specific type
+// The index of a data type within AllTypeVariant is one larger than within types because NullValue comes first.
+// Casting NULL_VALUE fails.
 
 // Template specialization for everything but integral types
 template <typename T>
 std::enable_if_t<!std::is_integral<T>::value, T> type_cast(const AllTypeVariant& value) {
-  if (value.which() == detail::index_of(types, hana::type_c<T>)) return get<T>(value);
+  if (value.which() == detail::index_of(types, hana::type_c<T>) + 1) return get<T>(value);
 
   return boost::lexical_cast<T>(value);
 }
@@ -46,7 +48,7 @@ std::enable_if_t<!std::is_integral<T>::value, T> type_cast(const AllTypeVariant&
 // Template specialization for integral types
 template <typename T>
 std::enable_if_t<std::is_integral<T>::value, T> type_cast(const AllTypeVariant& value) {
-  if (value.which() == detail::index_of(types, hana::type_c<T>)) return get<T>(value);
+  if (value.which() == detail::index_of(types, hana::type_c<T>) + 1) return get<T>(value);
 
   try {
     return boost::lexical_cast<T>(value);
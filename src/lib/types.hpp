@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <iostream>
 #include <limits>
+#include <memory_resource>  // NOLINT(build/include_order)
 #include <string>
 #include <tuple>
 #include <vector>
@@ -37,6 +38,36 @@ namespace opossum {
 using ChunkOffset = uint32_t;
 using AttributeVectorWidth = uint8_t;
 
+// Allocator of the buffers of the encoded segments. By default, it allocates with new and delete. Table uses an arena
+// per segment instead, see make_segment_in_arena.
+template <typename T>
+using PolymorphicAllocator = std::pmr::polymorphic_allocator<T>;
+
+template <typename T>
+using pmr_vector = std::vector<T, PolymorphicAllocator<T>>;
+
+// Determines how a DictionarySegment stores its value ids. FixedSize uses one, two, or four bytes per value id, which
+// can be scanned without decoding. BitPacked uses only as many bits as the largest value id needs.
+enum class AttributeVectorEncoding { FixedSize, BitPacked };
+
+// Determines which segment type Table::compress_chunk creates. RunLength and FrameOfReference fall back to Dictionary
+// for columns they cannot encode, i.e., FrameOfReference for non-integer columns or blocks with too wide value ranges.
+enum class SegmentEncoding { Dictionary, RunLength, FrameOfReference };
+
+struct SegmentEncodingSpec {
+  SegmentEncodingSpec(SegmentEncoding init_encoding = SegmentEncoding::Dictionary,  // NOLINT
+                      AttributeVectorEncoding init_attribute_vector_encoding = AttributeVectorEncoding::FixedSize)
+      : encoding(init_encoding), attribute_vector_encoding(init_attribute_vector_encoding) {}
+
+  SegmentEncodingSpec(AttributeVectorEncoding init_attribute_vector_encoding)  // NOLINT
+      : SegmentEncodingSpec(SegmentEncoding::Dictionary, init_attribute_vector_encoding) {}
+
+  SegmentEncoding encoding;
+
+  // only used by DictionarySegments, including those that other encodings fall back to
+  AttributeVectorEncoding attribute_vector_encoding;
+};
+
 struct RowID {
   ChunkID chunk_id;
   ChunkOffset chunk_offset;
@@ -51,9 +82,29 @@ struct RowID {
   }
 };
 
+// Used in position lists to denote a row that does not exist, e.g., the missing join partner in a left outer join.
+// ReferenceSegments return NULL_VALUE for it.
+constexpr RowID NULL_ROW_ID = RowID{ChunkID{std::numeric_limits<ChunkID::base_type>::max()},
+                                    std::numeric_limits<ChunkOffset>::max()};
+
 enum class ScanType { OpEquals, OpNotEquals, OpLessThan, OpLessThanEquals, OpGreaterThan, OpGreaterThanEquals };
 
-using PosList = std::vector<RowID>;
+// Inner joins return all pairs of matching rows. Left outer joins additionally return the left rows without a match,
+// paired with NULL_ROW_ID. Semi and anti joins return the left rows with and without a match, respectively.
+enum class JoinMode { Inner, Left, Semi, Anti };
+
+// The aggregate functions of the Aggregate operator. COUNT without a column counts rows (COUNT(*)).
+enum class AggregateFunction { Min, Max, Sum, Avg, Count };
+
+// Like in PostgreSQL, NULLs are sorted after all values in ascending order and before them in descending order
+enum class OrderByMode { Ascending, Descending };
+
+// Sort either outputs ReferenceSegments that point to the sorted rows of the input or copies the values into
+// ValueSegments
+enum class SortOutputMode { References, Materialized };
+
+// see storage/pos_list.hpp
+class PosList;
 
 // Prevents unnecessary, potentially expensive, copies by deleting copy constructor and copy assignment operator.
 class Noncopyable {
@@ -0,0 +1,423 @@
+#include "binary_table.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/worker_pool.hpp"
+#include "storage/bit_packed_attribute_vector.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/fixed_size_attribute_vector.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/segment_buffer.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto BINARY_TABLE_MAGIC = std::array<char, 8>{'O', 'P', 'S', 'M', 'T', 'B', 'L', '\0'};
+
+// Arrays start at multiples of this alignment so that they are aligned within the mapping
+constexpr auto ARRAY_ALIGNMENT = uint64_t{8};
+
+enum class SegmentType : uint8_t { Value, Dictionary, RunLength, FrameOfReference };
+
+enum class AttributeVectorType : uint8_t { FixedSize8, FixedSize16, FixedSize32, BitPacked };
+
+class BinaryWriter {
+ public:
+  explicit BinaryWriter(const std::string& file_name) : _stream(file_name, std::ios::binary | std::ios::trunc) {
+    Assert(_stream.is_open(), "save_binary_table: Could not open file " + file_name);
+  }
+
+  template <typename T>
+  void write(const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be written");
+    _write_bytes(&value, sizeof(T));
+  }
+
+  void write_string(const std::string& string) {
+    write(static_cast<uint32_t>(string.size()));
+    _write_bytes(string.data(), string.size());
+  }
+
+  template <typename T>
+  void write_array(const T* data, const size_t count) {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be written");
+    const auto padding = std::array<char, ARRAY_ALIGNMENT>{};
+    _write_bytes(padding.data(), (ARRAY_ALIGNMENT - _position % ARRAY_ALIGNMENT) % ARRAY_ALIGNMENT);
+    _write_bytes(data, count * sizeof(T));
+  }
+
+  // Writes the values of a value vector or a dictionary. Strings are stored as an array of their lengths followed by
+  // an array of their concatenated characters.
+  template <typename T, typename Allocator>
+  void write_values(const std::vector<T, Allocator>& values) {
+    write(static_cast<uint64_t>(values.size()));
+    if constexpr (std::is_same_v<T, std::string>) {
+      std::vector<uint32_t> lengths;
+      lengths.reserve(values.size());
+      std::string characters;
+      for (const auto& value : values) {
+        lengths.push_back(static_cast<uint32_t>(value.size()));
+        characters += value;
+      }
+      write_array(lengths.data(), lengths.size());
+      write(static_cast<uint64_t>(characters.size()));
+      write_array(characters.data(), characters.size());
+    } else {
+      write_array(values.data(), values.size());
+    }
+  }
+
+  template <typename T>
+  void write_values(const SegmentBuffer<T>& values) {
+    write(static_cast<uint64_t>(values.size()));
+    write_array(values.data(), values.size());
+  }
+
+  uint64_t position() const { return _position; }
+
+  void close() {
+    _stream.close();
+    Assert(!_stream.fail(), "save_binary_table: Could not write file");
+  }
+
+ protected:
+  void _write_bytes(const void* data, const size_t size) {
+    _stream.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+    _position += size;
+  }
+
+  std::ofstream _stream;
+  uint64_t _position = 0;
+};
+
+// Read-only mapping of an entire file that is unmapped when the object is destroyed. The segments of a loaded table
+// reference their arrays in the mapping, so it is shared by all of them.
+class MappedFile : private Noncopyable {
+ public:
+  explicit MappedFile(const std::string& file_name) {
+    const auto file_descriptor = open(file_name.c_str(), O_RDONLY);
+    Assert(file_descriptor != -1, "load_binary_table: Could not open file " + file_name);
+
+    struct stat file_status;
+    if (fstat(file_descriptor, &file_status) == 0 && file_status.st_size > 0) {
+      _size = static_cast<size_t>(file_status.st_size);
+      _data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    }
+    // The mapping stays valid after the file descriptor is closed
+    ::close(file_descriptor);
+    Assert(_data != MAP_FAILED && _data != nullptr, "load_binary_table: Could not map file " + file_name);
+
+    // All of the file is read right away, so let the kernel read ahead as much as it can
+    madvise(_data, _size, MADV_WILLNEED);
+  }
+
+  ~MappedFile() {
+    if (_data != MAP_FAILED && _data != nullptr) munmap(_data, _size);
+  }
+
+  const char* data() const { return static_cast<const char*>(_data); }
+
+  size_t size() const { return _size; }
+
+ protected:
+  void* _data = nullptr;
+  size_t _size = 0;
+};
+
+class BinaryReader {
+ public:
+  BinaryReader(std::shared_ptr<const MappedFile> file, const uint64_t position)
+      : _file(std::move(file)), _position(position) {}
+
+  template <typename T>
+  T read() {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be read");
+    T value;
+    std::memcpy(&value, _read_bytes(sizeof(T)), sizeof(T));
+    return value;
+  }
+
+  std::string read_string() {
+    const auto size = read<uint32_t>();
+    return std::string(_read_bytes(size), size);
+  }
+
+  // Returns a pointer to an array within the mapping
+  template <typename T>
+  const T* read_array(const size_t count) {
+    _position += (ARRAY_ALIGNMENT - _position % ARRAY_ALIGNMENT) % ARRAY_ALIGNMENT;
+    return reinterpret_cast<const T*>(_read_bytes(count * sizeof(T)));
+  }
+
+  // Values is a std::vector, a pmr_vector, or a SegmentBuffer. Vectors get a copy of the array. A SegmentBuffer
+  // references the array within the mapping instead and keeps the mapping alive.
+  template <typename Values>
+  Values read_values() {
+    using T = typename Values::value_type;
+    const auto count = read<uint64_t>();
+    Assert(count <= _file->size(), "load_binary_table: The file is corrupted");
+    if constexpr (std::is_same_v<T, std::string>) {
+      const auto lengths = read_array<uint32_t>(count);
+      const auto character_count = read<uint64_t>();
+      auto characters = read_array<char>(character_count);
+      const auto characters_end = characters + character_count;
+
+      Values values;
+      values.reserve(count);
+      for (auto index = size_t{0}; index < count; ++index) {
+        Assert(lengths[index] <= static_cast<size_t>(characters_end - characters),
+               "load_binary_table: The file is corrupted");
+        values.emplace_back(characters, lengths[index]);
+        characters += lengths[index];
+      }
+      return values;
+    } else {
+      const auto values = read_array<T>(count);
+      if constexpr (std::is_same_v<Values, SegmentBuffer<T>>) {
+        return Values{values, count, _file};
+      } else {
+        return Values(values, values + count);
+      }
+    }
+  }
+
+ protected:
+  const char* _read_bytes(const size_t size) {
+    Assert(_position + size <= _file->size(), "load_binary_table: The file is truncated or corrupted");
+    const auto bytes = _file->data() + _position;
+    _position += size;
+    return bytes;
+  }
+
+  std::shared_ptr<const MappedFile> _file;
+  uint64_t _position;
+};
+
+template <typename T>
+void write_segment(BinaryWriter& writer, const BaseSegment& segment) {
+  // FrameOfReferenceSegments only exist for integer types
+  if constexpr (std::is_integral_v<T>) {
+    if (const auto frame_of_reference_segment = dynamic_cast<const FrameOfReferenceSegment<T>*>(&segment)) {
+      const auto& offsets = *frame_of_reference_segment->offsets();
+      writer.write(SegmentType::FrameOfReference);
+      writer.write_values(*frame_of_reference_segment->block_minima());
+      writer.write(static_cast<uint64_t>(offsets.size()));
+      writer.write(offsets.bit_width());
+      writer.write_values(offsets.words());
+      return;
+    }
+  }
+
+  if (const auto value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+    writer.write(SegmentType::Value);
+    const auto& values = value_segment->values();
+    if (values.size() == value_segment->size()) {
+      writer.write_values(values);
+    } else {
+      // preallocated segments hold more slots than published values
+      writer.write_values(std::vector<T>(values.cbegin(), values.cbegin() + value_segment->size()));
+    }
+  } else if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    writer.write(SegmentType::Dictionary);
+    const auto& dictionary = *dictionary_segment->dictionary();
+    if constexpr (std::is_same_v<T, std::string>) {
+      // Front-coded dictionaries are stored as they are
+      writer.write(static_cast<uint64_t>(dictionary.size()));
+      writer.write_values(dictionary.bytes());
+      writer.write_values(dictionary.block_offsets());
+    } else {
+      writer.write_values(dictionary);
+    }
+
+    const auto& attribute_vector = *dictionary_segment->attribute_vector();
+    if (const auto uint8_vector = dynamic_cast<const FixedSizeAttributeVector<uint8_t>*>(&attribute_vector)) {
+      writer.write(AttributeVectorType::FixedSize8);
+      writer.write_values(uint8_vector->values());
+    } else if (const auto uint16_vector = dynamic_cast<const FixedSizeAttributeVector<uint16_t>*>(&attribute_vector)) {
+      writer.write(AttributeVectorType::FixedSize16);
+      writer.write_values(uint16_vector->values());
+    } else if (const auto uint32_vector = dynamic_cast<const FixedSizeAttributeVector<uint32_t>*>(&attribute_vector)) {
+      writer.write(AttributeVectorType::FixedSize32);
+      writer.write_values(uint32_vector->values());
+    } else if (const auto bit_packed_vector = dynamic_cast<const BitPackedAttributeVector*>(&attribute_vector)) {
+      writer.write(AttributeVectorType::BitPacked);
+      writer.write(static_cast<uint64_t>(bit_packed_vector->size()));
+      writer.write(bit_packed_vector->bit_width());
+      writer.write_values(bit_packed_vector->words());
+    } else {
+      Fail("save_binary_table: Unknown attribute vector type");
+    }
+  } else if (const auto run_length_segment = dynamic_cast<const RunLengthSegment<T>*>(&segment)) {
+    writer.write(SegmentType::RunLength);
+    writer.write_values(*run_length_segment->values());
+    writer.write_values(*run_length_segment->end_positions());
+  } else {
+    Fail("save_binary_table: Only ValueSegments and encoded segments can be saved");
+  }
+}
+
+template <typename T>
+std::shared_ptr<BaseSegment> read_segment(BinaryReader& reader) {
+  const auto segment_type = reader.read<SegmentType>();
+  if (segment_type == SegmentType::Value) {
+    return std::make_shared<ValueSegment<T>>(reader.read_values<std::vector<T>>());
+  }
+  if (segment_type == SegmentType::RunLength) {
+    using Values = typename RunLengthSegment<T>::Values;
+    auto values = std::make_shared<Values>(reader.read_values<Values>());
+    auto end_positions =
+        std::make_shared<SegmentBuffer<ChunkOffset>>(reader.read_values<SegmentBuffer<ChunkOffset>>());
+    Assert(values->size() == end_positions->size(), "load_binary_table: The file is corrupted");
+    return std::make_shared<RunLengthSegment<T>>(std::move(values), std::move(end_positions));
+  }
+  if constexpr (std::is_integral_v<T>) {
+    if (segment_type == SegmentType::FrameOfReference) {
+      auto block_minima = std::make_shared<SegmentBuffer<T>>(reader.read_values<SegmentBuffer<T>>());
+      const auto size = reader.read<uint64_t>();
+      const auto bit_width = reader.read<uint8_t>();
+      auto offsets =
+          std::make_shared<BitPackedAttributeVector>(size, bit_width, reader.read_values<SegmentBuffer<uint64_t>>());
+      return std::make_shared<FrameOfReferenceSegment<T>>(std::move(block_minima), std::move(offsets));
+    }
+  }
+  Assert(segment_type == SegmentType::Dictionary, "load_binary_table: Unknown segment type");
+
+  auto dictionary = std::shared_ptr<typename DictionarySegment<T>::Dictionary>{};
+  if constexpr (std::is_same_v<T, std::string>) {
+    const auto size = reader.read<uint64_t>();
+    auto bytes = reader.read_values<SegmentBuffer<char>>();
+    auto block_offsets = reader.read_values<SegmentBuffer<uint64_t>>();
+    dictionary = std::make_shared<FrontCodedDictionary>(std::move(bytes), std::move(block_offsets), size);
+  } else {
+    dictionary = std::make_shared<SegmentBuffer<T>>(reader.read_values<SegmentBuffer<T>>());
+  }
+
+  std::shared_ptr<BaseAttributeVector> attribute_vector;
+  switch (reader.read<AttributeVectorType>()) {
+    case AttributeVectorType::FixedSize8:
+      attribute_vector =
+          std::make_shared<FixedSizeAttributeVector<uint8_t>>(reader.read_values<SegmentBuffer<uint8_t>>());
+      break;
+    case AttributeVectorType::FixedSize16:
+      attribute_vector =
+          std::make_shared<FixedSizeAttributeVector<uint16_t>>(reader.read_values<SegmentBuffer<uint16_t>>());
+      break;
+    case AttributeVectorType::FixedSize32:
+      attribute_vector =
+          std::make_shared<FixedSizeAttributeVector<uint32_t>>(reader.read_values<SegmentBuffer<uint32_t>>());
+      break;
+    case AttributeVectorType::BitPacked: {
+      const auto size = reader.read<uint64_t>();
+      const auto bit_width = reader.read<uint8_t>();
+      attribute_vector =
+          std::make_shared<BitPackedAttributeVector>(size, bit_width, reader.read_values<SegmentBuffer<uint64_t>>());
+      break;
+    }
+    default:
+      Fail("load_binary_table: Unknown attribute vector type");
+  }
+
+  return std::make_shared<DictionarySegment<T>>(std::move(dictionary), std::move(attribute_vector));
+}
+
+}  // namespace
+
+void save_binary_table(const Table& table, const std::string& file_name) {
+  auto writer = BinaryWriter{file_name};
+
+  writer.write(BINARY_TABLE_MAGIC);
+  writer.write(BINARY_TABLE_VERSION);
+  writer.write(table.max_chunk_size());
+  writer.write(table.column_count());
+  for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
+    writer.write_string(table.column_name(column_id));
+    writer.write_string(table.column_type(column_id));
+  }
+
+  std::vector<uint64_t> chunk_offsets;
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    chunk_offsets.push_back(writer.position());
+
+    // The first chunk of a table whose columns were only defined (see Table::add_column_definition) has no segments
+    writer.write(chunk->column_count());
+    for (ColumnID column_id{0}; column_id < chunk->column_count(); ++column_id) {
+      resolve_data_type(table.column_type(column_id), [&](auto type) {
+        using Type = typename decltype(type)::type;
+        write_segment<Type>(writer, *chunk->get_segment(column_id));
+      });
+    }
+  }
+
+  const auto chunk_offsets_position = writer.position();
+  writer.write_values(chunk_offsets);
+  writer.write(chunk_offsets_position);
+  writer.close();
+}
+
+std::shared_ptr<Table> load_binary_table(const std::string& file_name) {
+  const auto file = std::make_shared<const MappedFile>(file_name);
+
+  auto reader = BinaryReader{file, 0};
+  Assert(reader.read<std::array<char, 8>>() == BINARY_TABLE_MAGIC,
+         "load_binary_table: " + file_name + " is not a binary table file");
+  const auto version = reader.read<uint32_t>();
+  Assert(version == BINARY_TABLE_VERSION, "load_binary_table: " + file_name + " has the unsupported version " +
+                                              std::to_string(version));
+
+  auto table = std::make_shared<Table>(reader.read<uint32_t>());
+  const auto column_count = reader.read<uint16_t>();
+  for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
+    auto column_name = reader.read_string();
+    auto column_type = reader.read_string();
+    table->add_column_definition(column_name, column_type);
+  }
+
+  Assert(file->size() >= sizeof(uint64_t), "load_binary_table: The file is truncated or corrupted");
+  auto footer_reader = BinaryReader{file, file->size() - sizeof(uint64_t)};
+  auto chunk_offsets_reader = BinaryReader{file, footer_reader.read<uint64_t>()};
+  const auto chunk_offsets = chunk_offsets_reader.read_values<std::vector<uint64_t>>();
+
+  // The chunks are independent of each other, so they are decoded in parallel
+  std::vector<Chunk> chunks(chunk_offsets.size());
+  std::vector<std::function<void()>> jobs;
+  for (auto chunk_index = size_t{0}; chunk_index < chunk_offsets.size(); ++chunk_index) {
+    jobs.emplace_back([&, chunk_index]() {
+      auto chunk_reader = BinaryReader{file, chunk_offsets[chunk_index]};
+      const auto segment_count = chunk_reader.read<uint16_t>();
+      Assert(segment_count == 0 || segment_count == column_count, "load_binary_table: The file is corrupted");
+      for (ColumnID column_id{0}; column_id < segment_count; ++column_id) {
+        resolve_data_type(table->column_type(column_id), [&](auto type) {
+          using Type = typename decltype(type)::type;
+          chunks[chunk_index].add_segment(read_segment<Type>(chunk_reader));
+        });
+      }
+      chunks[chunk_index].compute_statistics();
+    });
+  }
+  WorkerPool::get().run_and_wait(jobs);
+
+  for (auto& chunk : chunks) table->emplace_chunk(std::move(chunk));
+  return table;
+}
+
+}  // namespace opossum
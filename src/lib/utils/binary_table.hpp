@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace opossum {
+
+class Table;
+
+// Version of the binary table format. Increase it whenever the layout changes, files of other versions are rejected.
+constexpr uint32_t BINARY_TABLE_VERSION = 2;
+
+/**
+ * Writes a table into a binary file that stores every segment as it is, i.e., ValueSegments as their value vectors,
+ * DictionarySegments as their dictionaries (front-coded for strings) and attribute vectors, RunLengthSegments as their
+ * run values and end positions, and FrameOfReferenceSegments as their block minima and packed offsets. All arrays are
+ * aligned to eight bytes.
+ *
+ * Layout (all integers in the byte order of the CPU):
+ *   header:  magic "OPSMTBL\0", version, maximum chunk size, column count, column names and types
+ *   chunks:  for each chunk, the segment count followed by the segments
+ *   footer:  offset of each chunk within the file, chunk count, offset of the chunk offsets
+ *
+ * Only tables that consist of ValueSegments and encoded segments can be saved, ReferenceSegments cannot.
+ */
+void save_binary_table(const Table& table, const std::string& file_name);
+
+// Loads a table written by save_binary_table. The file is mapped into memory and the chunks are decoded in parallel.
+// The encoded segments reference their arrays within the mapping, which stays mapped as long as one of them exists.
+// ValueSegments can still be appended to and strings have to be constructed, so their values are copied out of the
+// mapping. Loading does not parse or convert any values.
+std::shared_ptr<Table> load_binary_table(const std::string& file_name);
+
+}  // namespace opossum
@@ -1,34 +1,279 @@
 #include "load_table.hpp"
 
+#include <charconv>
+
+#include <algorithm>
+#include <cstring>
 #include <fstream>
+#include <functional>
 #include <memory>
+#include <numeric>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "resolve_type.hpp"
+#include "scheduler/worker_pool.hpp"
 #include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
-std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_size) {
-  std::ifstream infile(file_name);
+namespace {
+
+// Byte ranges are at least this large, so that small files are not split up needlessly
+constexpr auto MIN_RANGE_SIZE = size_t{1} << 16;
+
+// Half-open range of characters within the file
+struct CharacterRange {
+  const char* begin;
+  const char* end;
+};
+
+template <typename T>
+T parse_value(const char* begin, const char* end) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    return std::string(begin, end);
+  } else {
+    T value{};
+#if !defined(__cpp_lib_to_chars)
+    // Older standard libraries only implement std::from_chars for integers
+    if constexpr (std::is_floating_point_v<T>) {
+      const auto string = std::string(begin, end);
+      auto parsed_characters = size_t{0};
+      try {
+        value = std::is_same_v<T, float> ? std::stof(string, &parsed_characters)
+                                         : std::stod(string, &parsed_characters);
+      } catch (const std::exception&) {
+        parsed_characters = 0;
+      }
+      Assert(!string.empty() && parsed_characters == string.size(), "load_table: Could not parse '" + string + "'");
+      return value;
+    }
+#endif
+    const auto result = std::from_chars(begin, end, value);
+    const auto parsed = result.ec == std::errc() && result.ptr == end;
+    Assert(parsed, "load_table: Could not parse '" + std::string(begin, end) + "'");
+    return value;
+  }
+}
+
+// The parsed values of one column of one chunk
+class BaseColumnBuffer {
+ public:
+  virtual ~BaseColumnBuffer() = default;
+
+  // parses a field and stores the value at the given offset
+  virtual void parse(const char* begin, const char* end, const ChunkOffset chunk_offset) = 0;
+
+  // moves the values into a ValueSegment
+  virtual std::shared_ptr<BaseSegment> create_segment() = 0;
+};
+
+template <typename T>
+class ColumnBuffer : public BaseColumnBuffer {
+ public:
+  explicit ColumnBuffer(const size_t size) : _values(size) {}
+
+  void parse(const char* begin, const char* end, const ChunkOffset chunk_offset) override {
+    _values[chunk_offset] = parse_value<T>(begin, end);
+  }
+
+  std::shared_ptr<BaseSegment> create_segment() override {
+    return std::make_shared<ValueSegment<T>>(std::move(_values));
+  }
+
+ protected:
+  std::vector<T> _values;
+};
+
+// Returns the line that starts at begin without its line break. Windows line breaks are accepted as well.
+CharacterRange next_line(const char* begin, const char* end) {
+  const auto line_break = static_cast<const char*>(std::memchr(begin, '\n', static_cast<size_t>(end - begin)));
+  auto line_end = line_break ? line_break : end;
+  if (line_end != begin && *(line_end - 1) == '\r') --line_end;
+  return {begin, line_end};
+}
+
+// Returns the position after the line break that ends the line at begin
+const char* skip_line(const char* begin, const char* end) {
+  const auto line_break = static_cast<const char*>(std::memchr(begin, '\n', static_cast<size_t>(end - begin)));
+  return line_break ? line_break + 1 : end;
+}
+
+// Splits a line into its fields and calls functor(begin, end, column_id) for each of them
+template <typename Functor>
+void for_each_field(const CharacterRange& line, const char delimiter, const size_t column_count,
+                    const Functor& functor) {
+  auto field_begin = line.begin;
+  for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
+    const auto delimiter_position = static_cast<const char*>(
+        std::memchr(field_begin, delimiter, static_cast<size_t>(line.end - field_begin)));
+    const auto field_end = delimiter_position ? delimiter_position : line.end;
+
+    if (column_id + size_t{1} < column_count) {
+      Assert(delimiter_position, "load_table: Too few fields in line '" + std::string(line.begin, line.end) + "'");
+    } else {
+      // A delimiter at the very end of the line is allowed, e.g., as written by some .tbl generators
+      Assert(!delimiter_position || delimiter_position + 1 == line.end,
+             "load_table: Too many fields in line '" + std::string(line.begin, line.end) + "'");
+    }
+
+    functor(field_begin, field_end, column_id);
+    field_begin = field_end + 1;
+  }
+}
+
+std::vector<std::string> split_header_line(const CharacterRange& line, const char delimiter) {
+  std::vector<std::string> fields;
+  auto field_begin = line.begin;
+  while (field_begin <= line.end) {
+    const auto delimiter_position = static_cast<const char*>(
+        std::memchr(field_begin, delimiter, static_cast<size_t>(line.end - field_begin)));
+    const auto field_end = delimiter_position ? delimiter_position : line.end;
+    // Ignore a trailing delimiter
+    if (field_begin != line.end || delimiter_position) fields.emplace_back(field_begin, field_end);
+    field_begin = field_end + 1;
+  }
+  return fields;
+}
+
+size_t count_rows(const CharacterRange& range) {
+  auto row_count = size_t{0};
+  for (auto position = range.begin; position < range.end; position = skip_line(position, range.end)) {
+    const auto line = next_line(position, range.end);
+    if (line.begin != line.end) ++row_count;
+  }
+  return row_count;
+}
+
+}  // namespace
+
+std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_size, const LoadTableOptions& options) {
+  std::ifstream infile(file_name, std::ios::binary);
   Assert(infile.is_open(), "load_table: Could not find file " + file_name);
+  Assert(chunk_size > 0, "load_table: The chunk size has to be positive");
 
-  std::string line;
-  std::getline(infile, line);
-  std::vector<std::string> column_names = _split<std::string>(line, '|');
-  std::getline(infile, line);
-  std::vector<std::string> column_types = _split<std::string>(line, '|');
+  // Read the entire file at once instead of line by line
+  infile.seekg(0, std::ios::end);
+  auto contents = std::string(static_cast<size_t>(infile.tellg()), '\0');
+  infile.seekg(0, std::ios::beg);
+  infile.read(contents.data(), static_cast<std::streamsize>(contents.size()));
+  Assert(!infile.fail(), "load_table: Could not read file " + file_name);
 
-  std::shared_ptr<Table> test_table = std::make_shared<Table>(chunk_size);
-  for (size_t i = 0; i < column_names.size(); i++) {
-    test_table->add_column(column_names[i], column_types[i]);
+  const char* const file_end = contents.data() + contents.size();
+  const char* body_begin = contents.data();
+
+  std::vector<std::string> column_names;
+  auto column_types = options.column_types;
+  if (options.header != TableFileHeader::None) {
+    column_names = split_header_line(next_line(body_begin, file_end), options.delimiter);
+    body_begin = skip_line(body_begin, file_end);
+  }
+  if (options.header == TableFileHeader::NamesAndTypes) {
+    Assert(column_types.empty(), "load_table: The column types are already given in the file");
+    column_types = split_header_line(next_line(body_begin, file_end), options.delimiter);
+    body_begin = skip_line(body_begin, file_end);
+  }
+  Assert(!column_types.empty(), "load_table: The column types have to be given if the file does not contain them");
+  if (options.header == TableFileHeader::None) {
+    for (auto column_id = size_t{0}; column_id < column_types.size(); ++column_id) {
+      column_names.emplace_back("column_" + std::to_string(column_id));
+    }
   }
+  Assert(column_names.size() == column_types.size(), "load_table: The number of column names and types differ");
+  const auto column_count = column_types.size();
 
-  while (std::getline(infile, line)) {
-    std::vector<AllTypeVariant> values = _split<AllTypeVariant>(line, '|');
-    test_table->append(values);
+  // Split the rows into byte ranges that end at line breaks, so that each range consists of entire lines
+  const auto body_size = static_cast<size_t>(file_end - body_begin);
+  const auto range_count =
+      std::max(size_t{1}, std::min(body_size / MIN_RANGE_SIZE, size_t{4} * WorkerPool::get().worker_count()));
+  std::vector<CharacterRange> ranges;
+  auto range_begin = body_begin;
+  for (auto range_index = size_t{1}; range_index <= range_count; ++range_index) {
+    auto range_end = file_end;
+    if (range_index < range_count) {
+      const auto nominal_end = body_begin + range_index * body_size / range_count;
+      range_end = skip_line(std::max(range_begin, nominal_end - 1), file_end);
+    }
+    ranges.push_back({range_begin, range_end});
+    range_begin = range_end;
   }
-  return test_table;
+
+  // First pass: count the rows of each range, so that every row's position within the table is known
+  std::vector<size_t> range_row_counts(ranges.size());
+  std::vector<std::function<void()>> count_jobs;
+  for (auto range_index = size_t{0}; range_index < ranges.size(); ++range_index) {
+    count_jobs.emplace_back([&, range_index]() { range_row_counts[range_index] = count_rows(ranges[range_index]); });
+  }
+  WorkerPool::get().run_and_wait(count_jobs);
+
+  std::vector<size_t> range_first_rows(ranges.size() + 1, 0);
+  std::partial_sum(range_row_counts.cbegin(), range_row_counts.cend(), range_first_rows.begin() + 1);
+  const auto row_count = range_first_rows.back();
+
+  auto table = std::make_shared<Table>(chunk_size);
+  if (row_count == 0) {
+    for (auto column_id = size_t{0}; column_id < column_count; ++column_id) {
+      table->add_column(column_names[column_id], column_types[column_id]);
+    }
+    return table;
+  }
+
+  // Allocate the values of all chunks up front
+  const auto chunk_count = (row_count + chunk_size - 1) / chunk_size;
+  std::vector<std::vector<std::shared_ptr<BaseColumnBuffer>>> column_buffers(chunk_count);
+  for (auto chunk_index = size_t{0}; chunk_index < chunk_count; ++chunk_index) {
+    const auto chunk_row_count = std::min(chunk_size, row_count - chunk_index * chunk_size);
+    for (auto column_id = size_t{0}; column_id < column_count; ++column_id) {
+      column_buffers[chunk_index].push_back(
+          make_shared_by_data_type<BaseColumnBuffer, ColumnBuffer>(column_types[column_id], chunk_row_count));
+    }
+  }
+
+  // Second pass: parse the values of each range and write them to their final positions
+  std::vector<std::function<void()>> parse_jobs;
+  for (auto range_index = size_t{0}; range_index < ranges.size(); ++range_index) {
+    parse_jobs.emplace_back([&, range_index]() {
+      const auto& range = ranges[range_index];
+      auto row = range_first_rows[range_index];
+      for (auto position = range.begin; position < range.end; position = skip_line(position, range.end)) {
+        const auto line = next_line(position, range.end);
+        if (line.begin == line.end) continue;
+
+        auto& chunk_buffers = column_buffers[row / chunk_size];
+        const auto chunk_offset = static_cast<ChunkOffset>(row % chunk_size);
+        for_each_field(line, options.delimiter, column_count,
+                       [&](const char* begin, const char* end, const ColumnID column_id) {
+                         chunk_buffers[column_id]->parse(begin, end, chunk_offset);
+                       });
+        ++row;
+      }
+    });
+  }
+  WorkerPool::get().run_and_wait(parse_jobs);
+
+  for (auto column_id = size_t{0}; column_id < column_count; ++column_id) {
+    table->add_column_definition(column_names[column_id], column_types[column_id]);
+  }
+
+  // Create the segments and their zone maps
+  std::vector<Chunk> chunks(chunk_count);
+  std::vector<std::function<void()>> chunk_jobs;
+  for (auto chunk_index = size_t{0}; chunk_index < chunk_count; ++chunk_index) {
+    chunk_jobs.emplace_back([&, chunk_index]() {
+      for (const auto& column_buffer : column_buffers[chunk_index]) {
+        chunks[chunk_index].add_segment(column_buffer->create_segment());
+      }
+      chunks[chunk_index].compute_statistics();
+    });
+  }
+  WorkerPool::get().run_and_wait(chunk_jobs);
+
+  for (auto& chunk : chunks) table->emplace_chunk(std::move(chunk));
+  return table;
 }
 
 }  // namespace opossum
@@ -22,7 +22,26 @@ std::vector<T> _split(const std::string& str, char delimiter) {
   return internal;
 }
 
-// This is a helper method which is heavily used in our test suite
-std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_size);
+// Describes which header lines precede the rows of a table file
+enum class TableFileHeader {
+  NamesAndTypes,  // a line with the column names followed by a line with the column types (.tbl files)
+  Names,          // a line with the column names (CSV files)
+  None            // no header, the columns are named column_0, column_1, ...
+};
+
+struct LoadTableOptions {
+  char delimiter = '|';
+  TableFileHeader header = TableFileHeader::NamesAndTypes;
+
+  // The column types, which have to be given if the header does not contain them
+  std::vector<std::string> column_types;
+};
+
+// This is a helper method which is heavily used in our test suite. It loads a .tbl file by default, other delimiters
+// and header layouts (e.g., CSV files) can be set in the options.
+// The file is split into byte ranges, which are parsed in parallel. The values are written directly into the vectors
+// of the ValueSegments of the resulting table.
+std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_size,
+                                  const LoadTableOptions& options = LoadTableOptions{});
 
 }  // namespace opossum
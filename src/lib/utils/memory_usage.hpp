@@ -0,0 +1,42 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "all_type_variant.hpp"
+
+namespace opossum {
+
+// Helpers for the estimate_memory_usage() methods of the storage classes. These methods return the size of the object
+// itself plus the heap memory it owns. The helpers below only count the heap memory, i.e., the allocated capacity of
+// vectors rather than their size and the buffers of strings that are too long for the small string optimization.
+
+// Bytes of the control block that std::make_shared allocates next to the object, i.e., a vtable pointer and the
+// use and weak counts. Objects that are held via a std::shared_ptr add this to their own size.
+constexpr size_t SHARED_PTR_CONTROL_BLOCK_SIZE = sizeof(void*) + 2 * sizeof(std::atomic<int>);
+
+inline size_t heap_memory_usage(const std::string& string) {
+  // Short strings are stored within the std::string object and do not allocate
+  const auto object = reinterpret_cast<const char*>(&string);
+  if (string.data() >= object && string.data() < object + sizeof(std::string)) return 0;
+  return string.capacity() + 1;
+}
+
+inline size_t heap_memory_usage(const AllTypeVariant& variant) {
+  const auto string = boost::get<std::string>(&variant);
+  return string ? heap_memory_usage(*string) : 0;
+}
+
+template <typename T, typename Allocator>
+size_t heap_memory_usage(const std::vector<T, Allocator>& vector) {
+  auto bytes = vector.capacity() * sizeof(T);
+  if constexpr (std::is_same_v<T, std::string>) {
+    for (const auto& value : vector) bytes += heap_memory_usage(value);
+  }
+  return bytes;
+}
+
+}  // namespace opossum
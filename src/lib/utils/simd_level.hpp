@@ -0,0 +1,22 @@
+#pragma once
+
+namespace opossum {
+
+// The instruction sets that SIMD kernels can choose from. The kernels are compiled using target attributes instead of
+// global compiler flags, so that one binary runs on all CPUs and still uses the fastest instructions available.
+enum class SimdLevel { Scalar, SSE41, AVX2 };
+
+// Returns the most capable instruction set supported by the executing CPU. It is determined only once.
+inline SimdLevel simd_level() {
+  static const auto level = [] {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return SimdLevel::AVX2;
+    if (__builtin_cpu_supports("sse4.1")) return SimdLevel::SSE41;
+#endif
+    return SimdLevel::Scalar;
+  }();
+  return level;
+}
+
+}  // namespace opossum
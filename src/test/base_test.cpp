@@ -37,19 +37,19 @@ BaseTest::Matrix BaseTest::_table_to_matrix(const Table& table) {
   // set values
   unsigned row_offset = 0;
   for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); chunk_id++) {
-    const Chunk& chunk = table.get_chunk(chunk_id);
+    const auto chunk = table.get_chunk(chunk_id);
 
     // an empty table's chunk might be missing actual segments
-    if (chunk.size() == 0) continue;
+    if (chunk->size() == 0) continue;
 
     for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
-      std::shared_ptr<BaseSegment> segment = chunk.get_segment(column_id);
+      std::shared_ptr<BaseSegment> segment = chunk->get_segment(column_id);
 
-      for (ChunkOffset chunk_offset = 0; chunk_offset < chunk.size(); ++chunk_offset) {
+      for (ChunkOffset chunk_offset = 0; chunk_offset < chunk->size(); ++chunk_offset) {
         matrix[row_offset + chunk_offset][column_id] = (*segment)[chunk_offset];
       }
     }
-    row_offset += chunk.size();
+    row_offset += chunk->size();
   }
 
   return matrix;
@@ -124,7 +124,9 @@ void BaseTest::_print_matrix(const BaseTest::Matrix& matrix) {
 
   for (unsigned row = 0; row < left.size(); row++)
     for (ColumnID column_id{0}; column_id < left[row].size(); column_id++) {
-      if (tleft.column_type(column_id) == "float") {
+      if (variant_is_null(left[row][column_id]) || variant_is_null(right[row][column_id])) {
+        EXPECT_EQ(left[row][column_id], right[row][column_id]) << "Row:" << row + 1 << " Column:" << column_id + 1;
+      } else if (tleft.column_type(column_id) == "float") {
         auto left_val = type_cast<float>(left[row][column_id]);
         auto right_val = type_cast<float>(right[row][column_id]);
 
@@ -0,0 +1,201 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/aggregate.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsAggregateTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(3);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    _table->add_column("c", "double");
+    _table->append({1, "x", 1.5});
+    _table->append({2, "y", 2.5});
+    _table->append({1, "x", 3.5});
+    _table->append({3, "x", 4.0});
+    _table->append({2, "z", 0.5});
+    _table->append({1, "y", 2.0});
+    _table->append({3, "x", 1.0});
+  }
+
+  static std::shared_ptr<const Table> aggregate(const std::shared_ptr<const AbstractOperator>& input,
+                                                const std::vector<AggregateColumnDefinition>& aggregates,
+                                                const std::vector<ColumnID>& groupby_column_ids) {
+    auto aggregate = std::make_shared<Aggregate>(input, aggregates, groupby_column_ids);
+    aggregate->execute();
+    return aggregate->get_output();
+  }
+
+  std::shared_ptr<const AbstractOperator> wrap(const std::shared_ptr<Table>& table) {
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsAggregateTest, GroupByOneColumn) {
+  const auto result =
+      aggregate(wrap(_table),
+                {{ColumnID{2}, AggregateFunction::Sum},
+                 {ColumnID{2}, AggregateFunction::Avg},
+                 {ColumnID{1}, AggregateFunction::Min},
+                 {ColumnID{1}, AggregateFunction::Max},
+                 {ColumnID{0}, AggregateFunction::Count},
+                 {std::nullopt, AggregateFunction::Count}},
+                {ColumnID{0}});
+
+  EXPECT_EQ(result->column_names(),
+            (std::vector<std::string>{"a", "SUM(c)", "AVG(c)", "MIN(b)", "MAX(b)", "COUNT(a)", "COUNT(*)"}));
+  EXPECT_EQ(result->column_type(ColumnID{1}), "double");
+  EXPECT_EQ(result->column_type(ColumnID{5}), "long");
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  expected->add_column("SUM(c)", "double");
+  expected->add_column("AVG(c)", "double");
+  expected->add_column("MIN(b)", "string");
+  expected->add_column("MAX(b)", "string");
+  expected->add_column("COUNT(a)", "long");
+  expected->add_column("COUNT(*)", "long");
+  expected->append({1, 7.0, 7.0 / 3, "x", "y", int64_t{3}, int64_t{3}});
+  expected->append({2, 3.0, 1.5, "y", "z", int64_t{2}, int64_t{2}});
+  expected->append({3, 5.0, 2.5, "x", "x", int64_t{2}, int64_t{2}});
+  EXPECT_TABLE_EQ(result, expected, true);
+}
+
+TEST_F(OperatorsAggregateTest, GroupByMultipleColumns) {
+  const auto result = aggregate(wrap(_table), {{ColumnID{0}, AggregateFunction::Sum}}, {ColumnID{1}, ColumnID{0}});
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("b", "string");
+  expected->add_column("a", "int");
+  expected->add_column("SUM(a)", "long");
+  expected->append({"x", 1, int64_t{2}});
+  expected->append({"x", 3, int64_t{6}});
+  expected->append({"y", 1, int64_t{1}});
+  expected->append({"y", 2, int64_t{2}});
+  expected->append({"z", 2, int64_t{2}});
+  EXPECT_TABLE_EQ(result, expected, true);
+}
+
+TEST_F(OperatorsAggregateTest, WithoutGroupBy) {
+  const auto result = aggregate(
+      wrap(_table), {{ColumnID{0}, AggregateFunction::Max}, {std::nullopt, AggregateFunction::Count}}, {});
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("MAX(a)", "int");
+  expected->add_column("COUNT(*)", "long");
+  expected->append({3, int64_t{7}});
+  EXPECT_TABLE_EQ(result, expected, true);
+}
+
+TEST_F(OperatorsAggregateTest, DictionarySegments) {
+  const auto aggregates = std::vector<AggregateColumnDefinition>{{ColumnID{2}, AggregateFunction::Sum},
+                                                                 {ColumnID{0}, AggregateFunction::Min},
+                                                                 {std::nullopt, AggregateFunction::Count}};
+  const auto expected_by_a = aggregate(wrap(_table), aggregates, {ColumnID{0}});
+  const auto expected_by_b_and_a = aggregate(wrap(_table), aggregates, {ColumnID{1}, ColumnID{0}});
+
+  // The group-by columns are compressed in some chunks only, so that dictionary and hashed groups are merged
+  _table->compress_chunk(ChunkID{0});
+  _table->compress_chunk(ChunkID{2}, AttributeVectorEncoding::BitPacked);
+  EXPECT_TABLE_EQ(aggregate(wrap(_table), aggregates, {ColumnID{0}}), expected_by_a, true);
+  EXPECT_TABLE_EQ(aggregate(wrap(_table), aggregates, {ColumnID{1}, ColumnID{0}}), expected_by_b_and_a, true);
+}
+
+TEST_F(OperatorsAggregateTest, ReferenceSegmentsWithNulls) {
+  auto right_table = std::make_shared<Table>();
+  right_table->add_column("d", "int");
+  right_table->add_column("e", "int");
+  right_table->append({1, 10});
+  right_table->append({2, 20});
+  right_table->append({2, 30});
+
+  // a = 3 has no join partner, so its d and e are NULL
+  const auto join = std::make_shared<JoinHash>(wrap(_table), wrap(right_table), JoinMode::Left,
+                                               std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+
+  const auto by_a = aggregate(join,
+                              {{ColumnID{4}, AggregateFunction::Sum},
+                               {ColumnID{4}, AggregateFunction::Count},
+                               {std::nullopt, AggregateFunction::Count}},
+                              {ColumnID{0}});
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  expected->add_column("SUM(e)", "long");
+  expected->add_column("COUNT(e)", "long");
+  expected->add_column("COUNT(*)", "long");
+  expected->append({1, int64_t{30}, int64_t{3}, int64_t{3}});
+  expected->append({2, int64_t{100}, int64_t{4}, int64_t{4}});
+  expected->append({3, int64_t{0}, int64_t{0}, int64_t{2}});
+  EXPECT_TABLE_EQ(by_a, expected, true);
+
+  // Rows with a NULL group-by value are skipped
+  const auto by_d = aggregate(join, {{std::nullopt, AggregateFunction::Count}}, {ColumnID{3}});
+  EXPECT_EQ(by_d->row_count(), 2u);
+}
+
+TEST_F(OperatorsAggregateTest, EmptyInput) {
+  auto scan = std::make_shared<TableScan>(wrap(_table), ColumnID{0}, ScanType::OpGreaterThan, 10);
+  scan->execute();
+
+  const auto result = aggregate(scan, {{std::nullopt, AggregateFunction::Count}}, {ColumnID{1}});
+  EXPECT_EQ(result->row_count(), 0u);
+  ASSERT_EQ(result->chunk_count(), 1u);
+  EXPECT_EQ(result->get_chunk(ChunkID{0})->column_count(), 2u);
+
+  // Without group-by columns, the empty input still forms one group
+  const auto total =
+      aggregate(scan, {{std::nullopt, AggregateFunction::Count}, {ColumnID{0}, AggregateFunction::Sum}}, {});
+  auto expected = std::make_shared<Table>();
+  expected->add_column("COUNT(*)", "long");
+  expected->add_column("SUM(a)", "long");
+  expected->append({int64_t{0}, int64_t{0}});
+  EXPECT_TABLE_EQ(total, expected, true);
+}
+
+TEST_F(OperatorsAggregateTest, ManyGroups) {
+  // The groups of all chunks are spread over the partitions of the merge and still come out in order
+  auto table = std::make_shared<Table>(100);
+  table->add_column("a", "int");
+  table->add_column("b", "string");
+  for (auto row = 0; row < 3000; ++row) table->append({row % 500, std::to_string(row % 2)});
+  table->compress_chunk(ChunkID{3});
+
+  const auto result =
+      aggregate(wrap(table), {{std::nullopt, AggregateFunction::Count}, {ColumnID{0}, AggregateFunction::Sum}},
+                {ColumnID{1}, ColumnID{0}});
+  auto expected = std::make_shared<Table>();
+  expected->add_column("b", "string");
+  expected->add_column("a", "int");
+  expected->add_column("COUNT(*)", "long");
+  expected->add_column("SUM(a)", "long");
+  for (auto b = 0; b < 2; ++b) {
+    for (auto a = b; a < 500; a += 2) expected->append({std::to_string(b), a, int64_t{6}, int64_t{6} * a});
+  }
+  EXPECT_TABLE_EQ(result, expected, true);
+}
+
+TEST_F(OperatorsAggregateTest, InvalidAggregates) {
+  EXPECT_THROW(aggregate(wrap(_table), {{ColumnID{1}, AggregateFunction::Sum}}, {}), std::logic_error);
+  EXPECT_THROW(aggregate(wrap(_table), {{std::nullopt, AggregateFunction::Max}}, {}), std::logic_error);
+  EXPECT_THROW(aggregate(wrap(_table), {{ColumnID{0}, AggregateFunction::Count}}, {ColumnID{5}}), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,172 @@
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/aggregate.hpp"
+#include "operators/explain.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/pipeline.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsExplainTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(2);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    for (auto index = 0; index < 5; ++index) _table->append({index, std::string(10, 'x')});
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+    _scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 2);
+    _scan->execute();
+  }
+
+  static std::string explained(const std::shared_ptr<const AbstractOperator>& root, const ExplainFormat format) {
+    std::stringstream stream;
+    explain(root, stream, format);
+    return stream.str();
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+  std::shared_ptr<TableScan> _scan;
+};
+
+TEST_F(OperatorsExplainTest, PerformanceData) {
+  const auto& wrapper_data = _table_wrapper->performance_data();
+  EXPECT_TRUE(wrapper_data.executed);
+  EXPECT_EQ(wrapper_data.output_row_count, 5u);
+  EXPECT_EQ(wrapper_data.output_chunk_count, 3u);
+  EXPECT_EQ(wrapper_data.output_bytes, 0u);
+
+  const auto& scan_data = _scan->performance_data();
+  EXPECT_TRUE(scan_data.executed);
+  EXPECT_GE(scan_data.walltime.count(), 0);
+  EXPECT_EQ(scan_data.input_row_count_left, 5u);
+  EXPECT_EQ(scan_data.input_row_count_right, 0u);
+  EXPECT_EQ(scan_data.output_row_count, 3u);
+  EXPECT_EQ(scan_data.output_chunk_count, 2u);
+  EXPECT_GT(scan_data.output_bytes, 0u);
+
+  // The projection shares the segments of its input, so it allocates nothing
+  const auto projection = std::make_shared<Projection>(_scan, std::vector<ColumnID>{ColumnID{1}});
+  EXPECT_FALSE(projection->performance_data().executed);
+  projection->execute();
+  EXPECT_EQ(projection->performance_data().output_row_count, 3u);
+  EXPECT_EQ(projection->performance_data().output_bytes, 0u);
+}
+
+TEST_F(OperatorsExplainTest, Descriptions) {
+  EXPECT_EQ(_table_wrapper->description(), "TableWrapper");
+  EXPECT_EQ(_scan->description(), "TableScan (#0 >= 2)");
+  const auto projection = std::make_shared<Projection>(_scan, std::vector<ColumnID>{ColumnID{1}, ColumnID{0}});
+  EXPECT_EQ(projection->description(), "Projection (#1, #0)");
+  const auto aggregates = std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Sum},
+                                                                 {std::nullopt, AggregateFunction::Count}};
+  const auto aggregate = std::make_shared<Aggregate>(projection, aggregates, std::vector<ColumnID>{ColumnID{0}});
+  EXPECT_EQ(aggregate->description(), "Aggregate (SUM(#1), COUNT(*) GROUP BY #0)");
+  const auto pipeline = std::make_shared<Pipeline>(aggregate);
+  EXPECT_EQ(pipeline->name(), "Pipeline");
+  EXPECT_EQ(pipeline->description(),
+            "Pipeline (TableScan (#0 >= 2) -> Projection (#1, #0) -> Aggregate (SUM(#1), COUNT(*) GROUP BY #0))");
+}
+
+TEST_F(OperatorsExplainTest, Text) {
+  const auto join = std::make_shared<JoinHash>(_scan, _scan, JoinMode::Inner, std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+
+  const auto text = explained(join, ExplainFormat::Text);
+  EXPECT_EQ(text.find("[0] JoinHash (Inner, #0 = #0) | "), 0u);
+  EXPECT_NE(text.find("rows 3/3 -> 3, "), std::string::npos);
+  EXPECT_NE(text.find("\n  [1] TableScan (#0 >= 2) | "), std::string::npos);
+  EXPECT_NE(text.find("\n    [2] TableWrapper | "), std::string::npos);
+  // The scan is the input of both sides of the join, but is printed once
+  EXPECT_NE(text.find("\n  [1] TableScan (see above)\n"), std::string::npos);
+
+  const auto projection = std::make_shared<Projection>(_scan, std::vector<ColumnID>{ColumnID{1}});
+  EXPECT_NE(explained(projection, ExplainFormat::Text).find("[0] Projection (#1) | not executed\n"), std::string::npos);
+}
+
+TEST_F(OperatorsExplainTest, Json) {
+  auto table = std::make_shared<Table>();
+  table->add_column("s", "string");
+  table->append({"a\"b"});
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, std::string{"a\"b"});
+  scan->execute();
+
+  const auto json = explained(scan, ExplainFormat::Json);
+  EXPECT_EQ(json.find("{\"operators\": ["), 0u);
+  EXPECT_NE(json.find("{\"id\": 0, \"name\": \"TableScan\", \"description\": \"TableScan (#0 = a\\\"b)\", "
+                      "\"inputs\": [1], \"executed\": true, \"walltime_ns\": "),
+            std::string::npos);
+  EXPECT_NE(json.find("\"input_row_count_left\": 1, \"input_row_count_right\": 0, \"output_row_count\": 1, "
+                      "\"output_chunk_count\": 1, \"output_bytes\": "),
+            std::string::npos);
+  EXPECT_NE(json.find("{\"id\": 1, \"name\": \"TableWrapper\", \"description\": \"TableWrapper\", \"inputs\": [], "),
+            std::string::npos);
+}
+
+TEST_F(OperatorsExplainTest, RestoresStreamFormat) {
+  std::stringstream stream;
+  explain(_scan, stream);
+  stream << 0.5;
+  EXPECT_EQ(stream.str().substr(stream.str().size() - 3), "0.5");
+}
+
+TEST_F(OperatorsExplainTest, EscapesControlCharacters) {
+  const auto scan =
+      std::make_shared<TableScan>(_table_wrapper, ColumnID{1}, ScanType::OpEquals, std::string{"a\nb\x01"});
+  const auto json = explained(scan, ExplainFormat::Json);
+  EXPECT_NE(json.find("\"description\": \"TableScan (#1 = a\\nb\\u0001)\""), std::string::npos);
+}
+
+TEST_F(OperatorsExplainTest, FusedOperators) {
+  const auto projection = std::make_shared<Projection>(_scan, std::vector<ColumnID>{ColumnID{0}});
+  const auto pipeline = std::make_shared<Pipeline>(projection);
+  pipeline->execute();
+
+  const auto text = explained(pipeline, ExplainFormat::Text);
+  EXPECT_EQ(text.find("[0] Pipeline (TableScan (#0 >= 2) -> Projection (#0)) | "), 0u);
+  EXPECT_NE(text.find("\n  [1] TableScan (#0 >= 2) | fused into [0]\n  [2] Projection (#0) | fused into [0]\n"
+                      "  [3] TableWrapper | "),
+            std::string::npos);
+
+  const auto json = explained(pipeline, ExplainFormat::Json);
+  EXPECT_NE(json.find("\"inputs\": [3], \"executed\": true, "), std::string::npos);
+  EXPECT_NE(json.find("{\"id\": 2, \"name\": \"Projection\", \"description\": \"Projection (#0)\", \"inputs\": [1], "
+                      "\"executed\": false, "),
+            std::string::npos);
+  EXPECT_NE(json.find("\"fused_into\": 0}"), std::string::npos);
+  EXPECT_NE(json.find("\"fused_into\": null}"), std::string::npos);
+
+  const auto dot = explained(pipeline, ExplainFormat::Graphviz);
+  EXPECT_NE(dot.find("  op2 [label=\"Projection (#0)\\nfused into op0\", style=dashed];\n"), std::string::npos);
+}
+
+TEST_F(OperatorsExplainTest, Graphviz) {
+  const auto join = std::make_shared<JoinHash>(_scan, _table_wrapper, JoinMode::Semi,
+                                               std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+
+  const auto dot = explained(join, ExplainFormat::Graphviz);
+  EXPECT_EQ(dot.find("digraph {\n"), 0u);
+  EXPECT_NE(dot.find("  op0 [label=\"JoinHash (Semi, #0 = #0)\\n"), std::string::npos);
+  EXPECT_NE(dot.find("  op1 -> op0;\n  op2 -> op0;\n  op2 -> op1;\n"), std::string::npos);
+  EXPECT_EQ(dot.substr(dot.size() - 2), "}\n");
+}
+
+}  // namespace opossum
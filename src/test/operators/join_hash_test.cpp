@@ -0,0 +1,214 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/join_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsJoinHashTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _left_table = std::make_shared<Table>(2);
+    _left_table->add_column("a", "int");
+    _left_table->add_column("b", "float");
+    _left_table->append({1, 1.5f});
+    _left_table->append({2, 2.5f});
+    _left_table->append({2, 3.5f});
+    _left_table->append({3, 4.5f});
+    _left_table->append({5, 5.5f});
+    _left = std::make_shared<TableWrapper>(_left_table);
+    _left->execute();
+
+    _right_table = std::make_shared<Table>(3);
+    _right_table->add_column("c", "int");
+    _right_table->add_column("d", "string");
+    _right_table->append({2, "two"});
+    _right_table->append({2, "zwei"});
+    _right_table->append({3, "three"});
+    _right_table->append({4, "four"});
+    _right = std::make_shared<TableWrapper>(_right_table);
+    _right->execute();
+  }
+
+  // Returns the rows of the table in sorted order, so that results can be compared independent of the partitioning
+  static opossum::Matrix sorted_rows(const Table& table) {
+    opossum::Matrix rows;
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto chunk = table.get_chunk(chunk_id);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+        std::vector<AllTypeVariant> row;
+        for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+          row.push_back((*chunk->get_segment(column_id))[chunk_offset]);
+        }
+        rows.push_back(row);
+      }
+    }
+    std::sort(rows.begin(), rows.end());
+    return rows;
+  }
+
+  static std::shared_ptr<const Table> join(const std::shared_ptr<const AbstractOperator>& left,
+                                           const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
+                                           const std::pair<ColumnID, ColumnID>& column_ids) {
+    auto join = std::make_shared<JoinHash>(left, right, mode, column_ids);
+    join->execute();
+    return join->get_output();
+  }
+
+  std::shared_ptr<Table> _left_table;
+  std::shared_ptr<Table> _right_table;
+  std::shared_ptr<TableWrapper> _left;
+  std::shared_ptr<TableWrapper> _right;
+};
+
+TEST_F(OperatorsJoinHashTest, InnerJoin) {
+  const auto result = join(_left, _right, JoinMode::Inner, {ColumnID{0}, ColumnID{0}});
+
+  ASSERT_EQ(result->column_count(), 4u);
+  EXPECT_EQ(result->column_name(ColumnID{2}), "c");
+  EXPECT_EQ(result->column_type(ColumnID{3}), "string");
+
+  const auto expected = opossum::Matrix{
+      {2, 2.5f, 2, "two"}, {2, 2.5f, 2, "zwei"}, {2, 3.5f, 2, "two"}, {2, 3.5f, 2, "zwei"}, {3, 4.5f, 3, "three"}};
+  EXPECT_EQ(sorted_rows(*result), expected);
+}
+
+TEST_F(OperatorsJoinHashTest, LeftOuterJoin) {
+  const auto result = join(_left, _right, JoinMode::Left, {ColumnID{0}, ColumnID{0}});
+
+  const auto expected =
+      opossum::Matrix{{1, 1.5f, NULL_VALUE, NULL_VALUE}, {2, 2.5f, 2, "two"},  {2, 2.5f, 2, "zwei"},
+                      {2, 3.5f, 2, "two"},               {2, 3.5f, 2, "zwei"}, {3, 4.5f, 3, "three"},
+                      {5, 5.5f, NULL_VALUE, NULL_VALUE}};
+  EXPECT_EQ(sorted_rows(*result), expected);
+}
+
+TEST_F(OperatorsJoinHashTest, SemiAndAntiJoin) {
+  const auto semi_result = join(_left, _right, JoinMode::Semi, {ColumnID{0}, ColumnID{0}});
+  ASSERT_EQ(semi_result->column_count(), 2u);
+  EXPECT_EQ(sorted_rows(*semi_result), (opossum::Matrix{{2, 2.5f}, {2, 3.5f}, {3, 4.5f}}));
+
+  const auto anti_result = join(_left, _right, JoinMode::Anti, {ColumnID{0}, ColumnID{0}});
+  ASSERT_EQ(anti_result->column_count(), 2u);
+  EXPECT_EQ(sorted_rows(*anti_result), (opossum::Matrix{{1, 1.5f}, {5, 5.5f}}));
+}
+
+TEST_F(OperatorsJoinHashTest, EmptyResult) {
+  auto scan = std::make_shared<TableScan>(_right, ColumnID{0}, ScanType::OpGreaterThan, 10);
+  scan->execute();
+
+  const auto result = join(_left, scan, JoinMode::Inner, {ColumnID{0}, ColumnID{0}});
+  EXPECT_EQ(result->row_count(), 0u);
+  ASSERT_EQ(result->chunk_count(), 1u);
+  EXPECT_EQ(result->get_chunk(ChunkID{0})->column_count(), 4u);
+
+  const auto anti_result = join(_left, scan, JoinMode::Anti, {ColumnID{0}, ColumnID{0}});
+  EXPECT_EQ(anti_result->row_count(), 5u);
+}
+
+TEST_F(OperatorsJoinHashTest, DictionaryInputs) {
+  _left_table->compress_table();
+  _right_table->compress_chunk(ChunkID{0});
+
+  const auto result = join(_left, _right, JoinMode::Inner, {ColumnID{0}, ColumnID{0}});
+  EXPECT_EQ(result->row_count(), 5u);
+
+  const auto semi_result = join(_right, _left, JoinMode::Semi, {ColumnID{0}, ColumnID{0}});
+  EXPECT_EQ(sorted_rows(*semi_result), (opossum::Matrix{{2, "two"}, {2, "zwei"}, {3, "three"}}));
+}
+
+TEST_F(OperatorsJoinHashTest, ReferenceInputs) {
+  auto left_scan = std::make_shared<TableScan>(_left, ColumnID{1}, ScanType::OpGreaterThan, 2.0f);
+  left_scan->execute();
+  auto right_scan = std::make_shared<TableScan>(_right, ColumnID{1}, ScanType::OpNotEquals, "zwei");
+  right_scan->execute();
+
+  const auto result = join(left_scan, right_scan, JoinMode::Inner, {ColumnID{0}, ColumnID{0}});
+  const auto expected = opossum::Matrix{{2, 2.5f, 2, "two"}, {2, 3.5f, 2, "two"}, {3, 4.5f, 3, "three"}};
+  EXPECT_EQ(sorted_rows(*result), expected);
+
+  // The output references the stored tables, and columns from the same input share their position list
+  const auto chunk = result->get_chunk(ChunkID{0});
+  const auto left_segment = std::dynamic_pointer_cast<const ReferenceSegment>(chunk->get_segment(ColumnID{0}));
+  const auto right_segment = std::dynamic_pointer_cast<const ReferenceSegment>(chunk->get_segment(ColumnID{3}));
+  ASSERT_TRUE(left_segment && right_segment);
+  EXPECT_EQ(left_segment->referenced_table(), _left_table);
+  EXPECT_EQ(right_segment->referenced_table(), _right_table);
+  EXPECT_EQ(right_segment->referenced_column_id(), ColumnID{1});
+  EXPECT_EQ(left_segment->pos_list(),
+            std::dynamic_pointer_cast<const ReferenceSegment>(chunk->get_segment(ColumnID{1}))->pos_list());
+}
+
+TEST_F(OperatorsJoinHashTest, ScanOnJoinResult) {
+  auto join = std::make_shared<JoinHash>(_left, _right, JoinMode::Inner, std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+
+  // The columns of both inputs have different position lists, which both have to be filtered by the scan
+  auto scan = std::make_shared<TableScan>(join, ColumnID{3}, ScanType::OpEquals, "zwei");
+  scan->execute();
+  EXPECT_EQ(sorted_rows(*scan->get_output()), (opossum::Matrix{{2, 2.5f, 2, "zwei"}, {2, 3.5f, 2, "zwei"}}));
+
+  const auto chunk = scan->get_output()->get_chunk(ChunkID{0});
+  const auto left_segment = std::dynamic_pointer_cast<const ReferenceSegment>(chunk->get_segment(ColumnID{0}));
+  const auto right_segment = std::dynamic_pointer_cast<const ReferenceSegment>(chunk->get_segment(ColumnID{2}));
+  ASSERT_TRUE(left_segment && right_segment);
+  EXPECT_EQ(left_segment->referenced_table(), _left_table);
+  EXPECT_EQ(right_segment->referenced_table(), _right_table);
+  EXPECT_EQ(left_segment->pos_list(),
+            std::dynamic_pointer_cast<const ReferenceSegment>(chunk->get_segment(ColumnID{1}))->pos_list());
+  EXPECT_NE(left_segment->pos_list(), right_segment->pos_list());
+}
+
+TEST_F(OperatorsJoinHashTest, NullKeysHaveNoJoinPartner) {
+  auto left_join = std::make_shared<JoinHash>(_left, _right, JoinMode::Left, std::make_pair(ColumnID{0}, ColumnID{0}));
+  left_join->execute();
+
+  // Column c of the left join's output is NULL for the left rows 1 and 5
+  const auto inner_result = join(left_join, _right, JoinMode::Inner, {ColumnID{2}, ColumnID{0}});
+  EXPECT_EQ(inner_result->row_count(), 9u);
+
+  const auto anti_result = join(left_join, _right, JoinMode::Anti, {ColumnID{2}, ColumnID{0}});
+  const auto expected = opossum::Matrix{{1, 1.5f, NULL_VALUE, NULL_VALUE}, {5, 5.5f, NULL_VALUE, NULL_VALUE}};
+  EXPECT_EQ(sorted_rows(*anti_result), expected);
+}
+
+TEST_F(OperatorsJoinHashTest, ManyPartitions) {
+  auto left_table = std::make_shared<Table>(1000);
+  left_table->add_column("a", "long");
+  auto right_table = std::make_shared<Table>(1000);
+  right_table->add_column("b", "long");
+  for (auto value = int64_t{0}; value < 100'000; ++value) {
+    left_table->append({value % 5'000});
+    if (value % 2 == 0) right_table->append({value});
+  }
+  auto left = std::make_shared<TableWrapper>(left_table);
+  left->execute();
+  auto right = std::make_shared<TableWrapper>(right_table);
+  right->execute();
+
+  const auto result = join(left, right, JoinMode::Inner, {ColumnID{0}, ColumnID{0}});
+  EXPECT_EQ(result->row_count(), 50'000u);
+  EXPECT_GT(result->chunk_count(), 1u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < result->chunk_count(); ++chunk_id) {
+    const auto chunk = result->get_chunk(chunk_id);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      EXPECT_EQ((*chunk->get_segment(ColumnID{0}))[chunk_offset], (*chunk->get_segment(ColumnID{1}))[chunk_offset]);
+    }
+  }
+
+  const auto anti_result = join(left, right, JoinMode::Anti, {ColumnID{0}, ColumnID{0}});
+  EXPECT_EQ(anti_result->row_count(), 50'000u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,133 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/aggregate.hpp"
+#include "operators/pipeline.hpp"
+#include "operators/projection.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsPipelineTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(4);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    _table->add_column("c", "double");
+    for (auto index = 0; index < 30; ++index) {
+      _table->append({index, std::string(1, static_cast<char>('u' + index % 5)), index * 0.5});
+    }
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  // Executes the operators one at a time, so that the pipeline's result can be compared to it
+  static std::shared_ptr<const Table> execute_all(const std::vector<std::shared_ptr<AbstractOperator>>& operators) {
+    for (const auto& op : operators) op->execute();
+    return operators.back()->get_output();
+  }
+
+  static std::shared_ptr<const Table> execute_pipeline(const std::shared_ptr<const AbstractOperator>& root) {
+    auto pipeline = std::make_shared<Pipeline>(root);
+    pipeline->execute();
+    return pipeline->get_output();
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsPipelineTest, ScanProjectionAggregate) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 7);
+  auto projection = std::make_shared<Projection>(scan, std::vector<ColumnID>{ColumnID{2}, ColumnID{1}});
+  auto aggregate = std::make_shared<Aggregate>(
+      projection, std::vector<AggregateColumnDefinition>{{ColumnID{0}, AggregateFunction::Sum}},
+      std::vector<ColumnID>{ColumnID{1}});
+
+  auto pipeline = std::make_shared<Pipeline>(aggregate);
+  EXPECT_EQ(pipeline->sink(), aggregate);
+  ASSERT_EQ(pipeline->streaming_operators().size(), 2u);
+  EXPECT_EQ(pipeline->streaming_operators()[0], scan);
+  EXPECT_EQ(pipeline->input_left(), _table_wrapper);
+
+  pipeline->execute();
+  // The operators within the pipeline are not executed themselves
+  EXPECT_FALSE(scan->get_output());
+
+  EXPECT_TABLE_EQ(pipeline->get_output(), execute_all({scan, projection, aggregate}), true);
+}
+
+TEST_F(OperatorsPipelineTest, MaterializedOutput) {
+  auto projection = std::make_shared<Projection>(_table_wrapper, std::vector<ColumnID>{ColumnID{2}, ColumnID{0}});
+  auto scan = std::make_shared<TableScan>(projection, ColumnID{1}, ScanType::OpLessThan, 10);
+  auto second_scan = std::make_shared<TableScan>(scan, ColumnID{0}, ScanType::OpGreaterThan, 1.0);
+
+  const auto result = execute_pipeline(second_scan);
+  EXPECT_TABLE_EQ(result, execute_all({projection, scan, second_scan}), true);
+  EXPECT_EQ(result->row_count(), 7u);
+
+  // The output references the stored table, and the projected columns point to their original columns
+  for (auto chunk_id = ChunkID{0}; chunk_id < result->chunk_count(); ++chunk_id) {
+    const auto segment =
+        std::dynamic_pointer_cast<const ReferenceSegment>(result->get_chunk(chunk_id)->get_segment(ColumnID{0}));
+    ASSERT_TRUE(segment);
+    EXPECT_EQ(segment->referenced_table(), _table);
+    EXPECT_EQ(segment->referenced_column_id(), ColumnID{2});
+  }
+}
+
+TEST_F(OperatorsPipelineTest, ReferenceSource) {
+  auto source_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpNotEquals, 3);
+  source_scan->execute();
+
+  auto scan = std::make_shared<TableScan>(source_scan, ColumnID{1}, ScanType::OpEquals, "v");
+  auto projection = std::make_shared<Projection>(scan, std::vector<ColumnID>{ColumnID{0}});
+  EXPECT_TABLE_EQ(execute_pipeline(projection), execute_all({scan, projection}), true);
+}
+
+TEST_F(OperatorsPipelineTest, CompressedChunks) {
+  _table->compress_table();
+  auto projection = std::make_shared<Projection>(_table_wrapper, std::vector<ColumnID>{ColumnID{1}, ColumnID{0}});
+  auto scan = std::make_shared<TableScan>(projection, ColumnID{1}, ScanType::OpEquals, 13);
+  auto aggregate = std::make_shared<Aggregate>(
+      scan, std::vector<AggregateColumnDefinition>{{std::nullopt, AggregateFunction::Count}},
+      std::vector<ColumnID>{ColumnID{0}});
+  EXPECT_TABLE_EQ(execute_pipeline(aggregate), execute_all({projection, scan, aggregate}), true);
+}
+
+TEST_F(OperatorsPipelineTest, EmptyResult) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 100);
+  auto projection = std::make_shared<Projection>(scan, std::vector<ColumnID>{ColumnID{1}});
+
+  const auto result = execute_pipeline(projection);
+  EXPECT_EQ(result->row_count(), 0u);
+  ASSERT_EQ(result->chunk_count(), 1u);
+  EXPECT_EQ(result->get_chunk(ChunkID{0})->column_count(), 1u);
+}
+
+TEST_F(OperatorsPipelineTest, InvalidPipelines) {
+  // Sort is neither a streaming operator nor a sink
+  auto sort = std::make_shared<Sort>(_table_wrapper, std::vector<SortColumnDefinition>{{ColumnID{0}}});
+  EXPECT_THROW(std::make_shared<Pipeline>(sort), std::logic_error);
+
+  // The source has to be executed first
+  auto sort_scan = std::make_shared<TableScan>(sort, ColumnID{0}, ScanType::OpEquals, 1);
+  auto pipeline = std::make_shared<Pipeline>(sort_scan);
+  EXPECT_THROW(pipeline->execute(), std::logic_error);
+
+  auto projection = std::make_shared<Projection>(_table_wrapper, std::vector<ColumnID>{ColumnID{3}});
+  EXPECT_THROW(execute_pipeline(projection), std::logic_error);
+}
+
+}  // namespace opossum
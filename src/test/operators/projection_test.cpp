@@ -0,0 +1,101 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsProjectionTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(2);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    _table->add_column("c", "double");
+    _table->append({1, "x", 1.5});
+    _table->append({2, "y", 2.5});
+    _table->append({3, "z", 3.5});
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  static std::shared_ptr<const Table> project(const std::shared_ptr<const AbstractOperator>& input,
+                                              const std::vector<ColumnID>& column_ids) {
+    auto projection = std::make_shared<Projection>(input, column_ids);
+    projection->execute();
+    return projection->get_output();
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsProjectionTest, SelectsAndReordersColumns) {
+  const auto result = project(_table_wrapper, {ColumnID{2}, ColumnID{0}, ColumnID{2}});
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("c", "double");
+  expected->add_column("a", "int");
+  expected->add_column("c", "double");
+  expected->append({1.5, 1, 1.5});
+  expected->append({2.5, 2, 2.5});
+  expected->append({3.5, 3, 3.5});
+  EXPECT_TABLE_EQ(result, expected, true);
+}
+
+TEST_F(OperatorsProjectionTest, SharesSegments) {
+  _table->compress_chunk(ChunkID{0});
+  const auto result = project(_table_wrapper, {ColumnID{1}, ColumnID{0}});
+
+  ASSERT_EQ(result->chunk_count(), 2u);
+  EXPECT_EQ(result->max_chunk_size(), 2u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < result->chunk_count(); ++chunk_id) {
+    const auto input_chunk = _table->get_chunk(chunk_id);
+    const auto output_chunk = result->get_chunk(chunk_id);
+    EXPECT_EQ(output_chunk->get_segment(ColumnID{0}), input_chunk->get_segment(ColumnID{1}));
+    EXPECT_EQ(output_chunk->get_segment(ColumnID{1}), input_chunk->get_segment(ColumnID{0}));
+  }
+}
+
+TEST_F(OperatorsProjectionTest, SharesPosLists) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 2);
+  scan->execute();
+  const auto result = project(scan, {ColumnID{2}, ColumnID{1}});
+  EXPECT_EQ(result->row_count(), 2u);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < result->chunk_count(); ++chunk_id) {
+    const auto input_segment = std::dynamic_pointer_cast<const ReferenceSegment>(
+        scan->get_output()->get_chunk(chunk_id)->get_segment(ColumnID{0}));
+    const auto output_segment =
+        std::dynamic_pointer_cast<const ReferenceSegment>(result->get_chunk(chunk_id)->get_segment(ColumnID{1}));
+    ASSERT_TRUE(output_segment);
+    EXPECT_EQ(output_segment->pos_list(), input_segment->pos_list());
+    EXPECT_EQ(output_segment->referenced_table(), _table);
+  }
+}
+
+TEST_F(OperatorsProjectionTest, EmptyInput) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 10);
+  scan->execute();
+
+  const auto result = project(scan, {ColumnID{1}});
+  EXPECT_EQ(result->row_count(), 0u);
+  EXPECT_EQ(result->column_count(), 1u);
+  EXPECT_EQ(result->column_name(ColumnID{0}), "b");
+}
+
+TEST_F(OperatorsProjectionTest, UnknownColumn) {
+  EXPECT_THROW(project(_table_wrapper, {ColumnID{0}, ColumnID{3}}), std::logic_error);
+}
+
+}  // namespace opossum
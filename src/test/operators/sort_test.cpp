@@ -0,0 +1,243 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/join_hash.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsSortTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(3);
+    _table->add_column("a", "int");
+    _table->add_column("b", "string");
+    _table->add_column("c", "double");
+    _table->append({3, "x", 1.5});
+    _table->append({-2, "yy", -2.5});
+    _table->append({3, "a", 0.0});
+    _table->append({1, "x", -0.5});
+    _table->append({-2, "b", 4.0});
+    _table->append({1, "yy", 2.0});
+    _table->append({0, "x", -10.0});
+  }
+
+  static std::shared_ptr<const Table> sorted(const std::shared_ptr<const AbstractOperator>& input,
+                                             const std::vector<SortColumnDefinition>& sort_definitions,
+                                             const SortOutputMode output_mode = SortOutputMode::References) {
+    auto sort = std::make_shared<Sort>(input, sort_definitions, output_mode);
+    sort->execute();
+    return sort->get_output();
+  }
+
+  // Returns the value of a row, counted across all chunks
+  static AllTypeVariant value(const Table& table, const ColumnID column_id, size_t row) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto chunk = table.get_chunk(chunk_id);
+      if (row < chunk->size()) return (*chunk->get_segment(column_id))[row];
+      row -= chunk->size();
+    }
+    return NULL_VALUE;
+  }
+
+  std::shared_ptr<const AbstractOperator> wrap(const std::shared_ptr<Table>& table) {
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsSortTest, SingleColumn) {
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  expected->add_column("b", "string");
+  expected->add_column("c", "double");
+  expected->append({-2, "yy", -2.5});
+  expected->append({-2, "b", 4.0});
+  expected->append({0, "x", -10.0});
+  expected->append({1, "x", -0.5});
+  expected->append({1, "yy", 2.0});
+  expected->append({3, "x", 1.5});
+  expected->append({3, "a", 0.0});
+
+  const auto result = sorted(wrap(_table), {{ColumnID{0}}});
+  EXPECT_TABLE_EQ(result, expected, true);
+  EXPECT_EQ(result->chunk_count(), 3u);
+  EXPECT_TRUE(
+      std::dynamic_pointer_cast<const ReferenceSegment>(result->get_chunk(ChunkID{0})->get_segment(ColumnID{0})));
+}
+
+TEST_F(OperatorsSortTest, Descending) {
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  expected->add_column("b", "string");
+  expected->add_column("c", "double");
+  expected->append({-2, "b", 4.0});
+  expected->append({1, "yy", 2.0});
+  expected->append({3, "x", 1.5});
+  expected->append({3, "a", 0.0});
+  expected->append({1, "x", -0.5});
+  expected->append({-2, "yy", -2.5});
+  expected->append({0, "x", -10.0});
+
+  EXPECT_TABLE_EQ(sorted(wrap(_table), {{ColumnID{2}, OrderByMode::Descending}}), expected, true);
+}
+
+TEST_F(OperatorsSortTest, MultipleColumns) {
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  expected->add_column("b", "string");
+  expected->add_column("c", "double");
+  expected->append({3, "a", 0.0});
+  expected->append({-2, "b", 4.0});
+  expected->append({3, "x", 1.5});
+  expected->append({1, "x", -0.5});
+  expected->append({0, "x", -10.0});
+  expected->append({1, "yy", 2.0});
+  expected->append({-2, "yy", -2.5});
+
+  const auto result = sorted(wrap(_table), {{ColumnID{1}}, {ColumnID{0}, OrderByMode::Descending}});
+  EXPECT_TABLE_EQ(result, expected, true);
+}
+
+TEST_F(OperatorsSortTest, EqualKeysKeepInputOrder) {
+  auto table = std::make_shared<Table>(2);
+  table->add_column("a", "int");
+  table->add_column("b", "int");
+  for (auto index = 0; index < 100; ++index) table->append({index % 3, index});
+
+  const auto result = sorted(wrap(table), {{ColumnID{0}}});
+  ASSERT_EQ(result->row_count(), 100u);
+  auto row = size_t{0};
+  for (auto key = 0; key < 3; ++key) {
+    for (auto index = key; index < 100; index += 3) {
+      const auto chunk = result->get_chunk(ChunkID{static_cast<ChunkID::base_type>(row / 2)});
+      EXPECT_EQ((*chunk->get_segment(ColumnID{1}))[row % 2], AllTypeVariant{index});
+      ++row;
+    }
+  }
+}
+
+TEST_F(OperatorsSortTest, LargeInput) {
+  // Enough rows for the radix sort of the partitions
+  auto table = std::make_shared<Table>(1000);
+  table->add_column("a", "long");
+  table->add_column("b", "float");
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "long");
+  expected->add_column("b", "float");
+  for (auto index = int64_t{0}; index < 5000; ++index) {
+    const auto value = (index * 7919) % 5000 - 2500;
+    table->append({value * 1'000'000, static_cast<float>(value % 7) / 2});
+    expected->append({(index - 2500) * 1'000'000, static_cast<float>((index - 2500) % 7) / 2});
+  }
+
+  EXPECT_TABLE_EQ(sorted(wrap(table), {{ColumnID{0}}}), expected, true);
+  const auto by_b = sorted(wrap(table), {{ColumnID{1}, OrderByMode::Descending}, {ColumnID{0}}});
+  EXPECT_EQ(value(*by_b, ColumnID{1}, 0), AllTypeVariant{3.0f});
+  EXPECT_EQ(value(*by_b, ColumnID{0}, 0), AllTypeVariant{int64_t{6'000'000}});
+  EXPECT_EQ(value(*by_b, ColumnID{1}, 4999), AllTypeVariant{-3.0f});
+}
+
+TEST_F(OperatorsSortTest, StringsOfManyChunks) {
+  // The distinct strings of the chunks overlap and are merged across several levels
+  auto table = std::make_shared<Table>(10);
+  table->add_column("s", "string");
+  std::vector<std::string> strings;
+  for (auto index = 0; index < 470; ++index) {
+    strings.push_back(std::to_string((index * 37) % 200));
+    table->append({strings.back()});
+  }
+  table->compress_chunk(ChunkID{5});
+
+  std::sort(strings.begin(), strings.end());
+  auto expected = std::make_shared<Table>();
+  expected->add_column("s", "string");
+  for (const auto& string : strings) expected->append({string});
+  EXPECT_TABLE_EQ(sorted(wrap(table), {{ColumnID{0}}}), expected, true);
+}
+
+TEST_F(OperatorsSortTest, DictionarySegments) {
+  const auto definitions = std::vector<SortColumnDefinition>{{ColumnID{1}}, {ColumnID{2}, OrderByMode::Descending}};
+  const auto expected = sorted(wrap(_table), definitions, SortOutputMode::Materialized);
+
+  // The chunks have different dictionaries, so their ValueIDs cannot be compared directly
+  _table->compress_chunk(ChunkID{0});
+  _table->compress_chunk(ChunkID{2}, AttributeVectorEncoding::BitPacked);
+  EXPECT_TABLE_EQ(sorted(wrap(_table), definitions), expected, true);
+  EXPECT_TABLE_EQ(sorted(wrap(_table), {{ColumnID{0}}, {ColumnID{1}}}),
+                  sorted(wrap(_table), {{ColumnID{0}}, {ColumnID{1}}}, SortOutputMode::Materialized), true);
+}
+
+TEST_F(OperatorsSortTest, ReferenceSegmentsWithNulls) {
+  auto right_table = std::make_shared<Table>();
+  right_table->add_column("d", "int");
+  right_table->add_column("e", "string");
+  right_table->append({1, "one"});
+  right_table->append({3, "three"});
+
+  // a = -2 and a = 0 have no join partner, so their d and e are NULL
+  const auto join = std::make_shared<JoinHash>(wrap(_table), wrap(right_table), JoinMode::Left,
+                                               std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+
+  const auto ascending = sorted(join, {{ColumnID{4}}, {ColumnID{2}}});
+  ASSERT_EQ(ascending->row_count(), 7u);
+  EXPECT_EQ(value(*ascending, ColumnID{4}, 0), AllTypeVariant{std::string{"one"}});
+  EXPECT_EQ(value(*ascending, ColumnID{2}, 0), AllTypeVariant{-0.5});
+  EXPECT_EQ(value(*ascending, ColumnID{4}, 3), AllTypeVariant{std::string{"three"}});
+  EXPECT_EQ(value(*ascending, ColumnID{2}, 4), AllTypeVariant{-10.0});
+  EXPECT_EQ(value(*ascending, ColumnID{2}, 6), AllTypeVariant{4.0});
+
+  // The output references the joined tables, not the output of the join
+  const auto segment =
+      std::dynamic_pointer_cast<const ReferenceSegment>(ascending->get_chunk(ChunkID{0})->get_segment(ColumnID{4}));
+  ASSERT_TRUE(segment);
+  EXPECT_EQ(segment->referenced_table(), right_table);
+
+  const auto descending = sorted(join, {{ColumnID{3}, OrderByMode::Descending}, {ColumnID{0}}});
+  EXPECT_EQ(value(*descending, ColumnID{0}, 0), AllTypeVariant{-2});
+  EXPECT_EQ(value(*descending, ColumnID{0}, 3), AllTypeVariant{3});
+  EXPECT_EQ(value(*descending, ColumnID{0}, 6), AllTypeVariant{1});
+
+  EXPECT_THROW(sorted(join, {{ColumnID{3}}}, SortOutputMode::Materialized), std::logic_error);
+}
+
+TEST_F(OperatorsSortTest, Materialized) {
+  const auto result = sorted(wrap(_table), {{ColumnID{2}}}, SortOutputMode::Materialized);
+  EXPECT_TABLE_EQ(result, sorted(wrap(_table), {{ColumnID{2}}}), true);
+  EXPECT_EQ(result->chunk_count(), 3u);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const ValueSegment<double>>(
+      result->get_chunk(ChunkID{2})->get_segment(ColumnID{2})));
+}
+
+TEST_F(OperatorsSortTest, EmptyInput) {
+  auto scan = std::make_shared<TableScan>(wrap(_table), ColumnID{0}, ScanType::OpGreaterThan, 10);
+  scan->execute();
+
+  const auto result = sorted(scan, {{ColumnID{1}}});
+  EXPECT_EQ(result->row_count(), 0u);
+  ASSERT_EQ(result->chunk_count(), 1u);
+  EXPECT_EQ(result->get_chunk(ChunkID{0})->column_count(), 3u);
+}
+
+TEST_F(OperatorsSortTest, InvalidSortColumns) {
+  EXPECT_THROW(sorted(wrap(_table), {}), std::logic_error);
+  EXPECT_THROW(sorted(wrap(_table), {{ColumnID{3}}}), std::logic_error);
+}
+
+}  // namespace opossum
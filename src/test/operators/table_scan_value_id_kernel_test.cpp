@@ -0,0 +1,47 @@
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_scan_value_id_kernel.hpp"
+#include "../lib/storage/pos_list.hpp"
+
+namespace opossum {
+
+class TableScanValueIdKernelTest : public BaseTest {
+ protected:
+  // Compares the kernel's output with a straightforward implementation for several ranges. 1000 value ids fill
+  // several SIMD registers and leave a tail that is scanned without SIMD.
+  template <typename T>
+  void _test_value_id_type() {
+    std::vector<T> value_ids;
+    for (auto index = uint32_t{0}; index < 1000; ++index) value_ids.push_back(static_cast<T>(index % 200));
+
+    const auto ranges = std::vector<std::pair<uint32_t, uint32_t>>{{0, 1}, {0, 200}, {17, 18}, {17, 150}, {199, 200},
+                                                                   {5, 5}};
+    for (const auto& [lower, upper] : ranges) {
+      for (const auto negate : {false, true}) {
+        PosList expected_pos_list;
+        for (ChunkOffset chunk_offset{0}; chunk_offset < value_ids.size(); ++chunk_offset) {
+          const auto in_range = value_ids[chunk_offset] >= lower && value_ids[chunk_offset] < upper;
+          if (in_range != negate) expected_pos_list.push_back(RowID{ChunkID{3}, chunk_offset});
+        }
+
+        auto pos_list = PosList{ChunkID{3}};
+        scan_value_id_range(value_ids.data(), value_ids.size(), ValueID{lower}, ValueID{upper}, negate, ChunkOffset{0},
+                            pos_list);
+        EXPECT_EQ(pos_list, expected_pos_list) << "range [" << lower << ", " << upper << "), negate " << negate;
+      }
+    }
+  }
+};
+
+TEST_F(TableScanValueIdKernelTest, Uint8ValueIds) { _test_value_id_type<uint8_t>(); }
+
+TEST_F(TableScanValueIdKernelTest, Uint16ValueIds) { _test_value_id_type<uint16_t>(); }
+
+TEST_F(TableScanValueIdKernelTest, Uint32ValueIds) { _test_value_id_type<uint32_t>(); }
+
+}  // namespace opossum
@@ -0,0 +1,58 @@
+#include <atomic>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/scheduler/worker_pool.hpp"
+
+namespace opossum {
+
+class WorkerPoolTest : public BaseTest {};
+
+TEST_F(WorkerPoolTest, RunsAllJobs) {
+  WorkerPool worker_pool{4, 2};
+  EXPECT_EQ(worker_pool.worker_count(), 4u);
+
+  std::atomic<uint32_t> sum{0};
+  std::vector<std::function<void()>> jobs;
+  for (auto value = uint32_t{1}; value <= 100; ++value) jobs.emplace_back([&sum, value]() { sum += value; });
+
+  worker_pool.run_and_wait(jobs);
+  EXPECT_EQ(sum, 5050u);
+}
+
+TEST_F(WorkerPoolTest, NestedJobsDoNotDeadlock) {
+  WorkerPool worker_pool{1, 1};
+
+  std::atomic<uint32_t> count{0};
+  std::vector<std::function<void()>> outer_jobs;
+  for (auto outer_index = 0; outer_index < 4; ++outer_index) {
+    outer_jobs.emplace_back([&]() {
+      std::vector<std::function<void()>> inner_jobs(4, [&count]() { ++count; });
+      worker_pool.run_and_wait(inner_jobs);
+    });
+  }
+
+  worker_pool.run_and_wait(outer_jobs);
+  EXPECT_EQ(count, 16u);
+}
+
+TEST_F(WorkerPoolTest, RethrowsExceptions) {
+  WorkerPool worker_pool{2, 4};
+  std::vector<std::function<void()>> jobs{[]() {}, []() { throw std::logic_error("job failed"); }};
+  EXPECT_THROW(worker_pool.run_and_wait(jobs), std::logic_error);
+}
+
+TEST_F(WorkerPoolTest, ScheduledJobsFinishBeforeDestruction) {
+  std::atomic<uint32_t> count{0};
+  {
+    WorkerPool worker_pool{2, 1};
+    for (auto index = 0; index < 10; ++index) worker_pool.schedule([&count]() { ++count; });
+  }
+  EXPECT_EQ(count, 10u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,59 @@
+#include <cstdint>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/bit_packed_attribute_vector.hpp"
+
+namespace opossum {
+
+class BitPackedAttributeVectorTest : public BaseTest {};
+
+TEST_F(BitPackedAttributeVectorTest, RequiredBitWidth) {
+  EXPECT_EQ(BitPackedAttributeVector::required_bit_width(1), 1u);
+  EXPECT_EQ(BitPackedAttributeVector::required_bit_width(2), 1u);
+  EXPECT_EQ(BitPackedAttributeVector::required_bit_width(3), 2u);
+  EXPECT_EQ(BitPackedAttributeVector::required_bit_width(300), 9u);
+  EXPECT_EQ(BitPackedAttributeVector::required_bit_width(65536), 16u);
+  EXPECT_EQ(BitPackedAttributeVector::required_bit_width(65537), 17u);
+}
+
+TEST_F(BitPackedAttributeVectorTest, Width) {
+  EXPECT_EQ(BitPackedAttributeVector(5, 3).width(), 1u);
+  EXPECT_EQ(BitPackedAttributeVector(5, 9).width(), 2u);
+  EXPECT_EQ(BitPackedAttributeVector(5, 17).width(), 4u);
+  EXPECT_EQ(BitPackedAttributeVector(5, 17).bit_width(), 17u);
+}
+
+TEST_F(BitPackedAttributeVectorTest, MemoryUsage) {
+  // 1000 value ids with 9 bits need 9000 bits, i.e., 141 words plus one word of padding
+  EXPECT_EQ(BitPackedAttributeVector(1000, 9).estimate_memory_usage(),
+            sizeof(BitPackedAttributeVector) + 142 * sizeof(uint64_t));
+}
+
+TEST_F(BitPackedAttributeVectorTest, SetGetAndDecodeAllBitWidths) {
+  for (auto bit_width = uint8_t{1}; bit_width <= 32; ++bit_width) {
+    const auto max_value_id = static_cast<uint32_t>((uint64_t{1} << bit_width) - 1);
+    auto attribute_vector = BitPackedAttributeVector(101, bit_width);
+
+    std::vector<uint32_t> expected_value_ids;
+    for (auto index = uint32_t{0}; index < attribute_vector.size(); ++index) {
+      // Alternate between the largest value id and small value ids to detect overwritten neighbors
+      expected_value_ids.push_back(index % 2 == 0 ? max_value_id : index & max_value_id);
+      attribute_vector.set(index, ValueID{expected_value_ids.back()});
+    }
+
+    for (auto index = uint32_t{0}; index < attribute_vector.size(); ++index) {
+      EXPECT_EQ(attribute_vector.get(index), expected_value_ids[index]) << "bit width " << +bit_width;
+    }
+
+    // Decode starting at an unaligned position to cover the scalar prologue, the blocks, and the scalar epilogue
+    std::vector<uint32_t> decoded_value_ids(98);
+    attribute_vector.decode(3, decoded_value_ids.size(), decoded_value_ids.data());
+    EXPECT_EQ(decoded_value_ids, std::vector<uint32_t>(expected_value_ids.begin() + 3, expected_value_ids.end()))
+        << "bit width " << +bit_width;
+  }
+}
+
+}  // namespace opossum
@@ -1,4 +1,6 @@
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
@@ -6,6 +8,7 @@
 #include "../lib/resolve_type.hpp"
 #include "../lib/storage/base_segment.hpp"
 #include "../lib/storage/chunk.hpp"
+#include "../lib/storage/value_segment.hpp"
 #include "../lib/types.hpp"
 
 namespace opossum {
@@ -47,6 +50,42 @@ TEST_F(StorageChunkTest, AddValuesToChunk) {
   }
 }
 
+TEST_F(StorageChunkTest, AppendColumns) {
+  c.add_segment(int_value_segment);
+  c.add_segment(string_value_segment);
+  c.append_columns({std::vector<int32_t>{5, 7}, std::vector<std::string>{"more", "values"}});
+  EXPECT_EQ(c.size(), 5u);
+  EXPECT_EQ((*c.get_segment(ColumnID{0}))[4], AllTypeVariant{7});
+  EXPECT_EQ((*c.get_segment(ColumnID{1}))[3], AllTypeVariant{"more"});
+
+  // Neither a wrong type nor a wrong number of values is appended to any of the segments
+  EXPECT_THROW(c.append_columns({std::vector<int32_t>{1}, std::vector<int32_t>{2}}), std::logic_error);
+  EXPECT_THROW(c.append_columns({std::vector<int32_t>{1}, std::vector<std::string>{}}), std::logic_error);
+  EXPECT_THROW(c.append_columns({std::vector<int32_t>{1}}), std::logic_error);
+  EXPECT_EQ(c.get_segment(ColumnID{0})->size(), 5u);
+  EXPECT_EQ(c.get_segment(ColumnID{1})->size(), 5u);
+}
+
+TEST_F(StorageChunkTest, Statistics) {
+  c.add_segment(int_value_segment);
+  c.add_segment(string_value_segment);
+  EXPECT_FALSE(c.statistics(ColumnID{0}));
+
+  c.compute_statistics();
+  const auto int_statistics = c.statistics(ColumnID{0});
+  ASSERT_TRUE(int_statistics);
+  EXPECT_EQ(int_statistics->min, AllTypeVariant{3});
+  EXPECT_EQ(int_statistics->max, AllTypeVariant{6});
+  EXPECT_FALSE(int_statistics->distinct_count);
+  EXPECT_EQ(c.statistics(ColumnID{1})->min, AllTypeVariant{"!"});
+  EXPECT_EQ(c.statistics(ColumnID{1})->max, AllTypeVariant{"world"});
+
+  // Appending discards the outdated zone maps
+  c.append({2, "two"});
+  EXPECT_FALSE(c.statistics(ColumnID{0}));
+  EXPECT_FALSE(c.statistics(ColumnID{1}));
+}
+
 TEST_F(StorageChunkTest, RetrieveSegment) {
   c.add_segment(int_value_segment);
   c.add_segment(string_value_segment);
@@ -71,4 +110,26 @@ TEST_F(StorageChunkTest, GetColumnCount) {
   EXPECT_EQ(c.column_count(), 2);
 }
 
+TEST_F(StorageChunkTest, ReserveAndPublishRows) {
+  auto chunk = Chunk{ChunkOffset{2}};
+  chunk.add_segment(std::make_shared<ValueSegment<int>>(ChunkOffset{2}, chunk.published_size()));
+  EXPECT_TRUE(chunk.is_preallocated());
+  EXPECT_EQ(chunk.capacity(), 2u);
+
+  EXPECT_EQ(chunk.reserve_row(), ChunkOffset{0});
+  EXPECT_EQ(chunk.reserve_row(), ChunkOffset{1});
+  EXPECT_EQ(chunk.reserve_row(), std::nullopt);
+  EXPECT_EQ(chunk.size(), 0u);
+
+  const auto segment = std::static_pointer_cast<ValueSegment<int>>(chunk.get_segment(ColumnID{0}));
+  segment->set(ChunkOffset{0}, 7);
+  chunk.publish_row(ChunkOffset{0});
+  EXPECT_EQ(chunk.size(), 1u);
+  EXPECT_EQ(segment->size(), 1u);
+  EXPECT_THROW(chunk.append({1}), std::logic_error);
+
+  EXPECT_FALSE(c.is_preallocated());
+  EXPECT_EQ(c.reserve_row(), std::nullopt);
+}
+
 }  // namespace opossum
@@ -1,14 +1,18 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
 
 #include "resolve_type.hpp"
 #include "storage/base_segment.hpp"
+#include "storage/bit_packed_attribute_vector.hpp"
 #include "storage/dictionary_segment.hpp"
+#include "storage/segment_arena.hpp"
 #include "storage/value_segment.hpp"
+#include "utils/memory_usage.hpp"
 
 namespace opossum {
 
@@ -99,7 +103,24 @@ TEST_F(StorageDictionarySegmentTest, MemoryUsage) {
   auto col = make_shared_by_data_type<BaseSegment, DictionarySegment>("int", vc_int);
   auto int_dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<int>>(col);
 
-  EXPECT_EQ(int_dictionary_segment->estimate_memory_usage(), 5 * sizeof(int) + 5 * sizeof(uint8_t));
+  const auto dictionary_bytes = sizeof(SegmentBuffer<int>) + 5 * sizeof(int);
+  const auto attribute_vector_bytes = sizeof(FixedSizeAttributeVector<uint8_t>) + 5 * sizeof(uint8_t);
+  EXPECT_EQ(int_dictionary_segment->estimate_memory_usage(), sizeof(DictionarySegment<int>) +
+                                                                 2 * SHARED_PTR_CONTROL_BLOCK_SIZE + dictionary_bytes +
+                                                                 attribute_vector_bytes);
+}
+
+TEST_F(StorageDictionarySegmentTest, AllocatesFromArena) {
+  for (auto value = 0; value < 300; ++value) vc_int->append(value % 100);
+  const auto arena = std::make_shared<SegmentArena>(MIN_SEGMENT_ARENA_SIZE);
+  const auto dict_col = DictionarySegment<int>(vc_int, AttributeVectorEncoding::FixedSize, ArenaAllocator<int>{arena});
+
+  EXPECT_EQ(dict_col.dictionary()->get_allocator().resource(), arena.get());
+  const auto attribute_vector =
+      std::dynamic_pointer_cast<const FixedSizeAttributeVector<uint8_t>>(dict_col.attribute_vector());
+  ASSERT_TRUE(attribute_vector);
+  EXPECT_EQ(attribute_vector->values().get_allocator().resource(), arena.get());
+  EXPECT_EQ(dict_col.get(ChunkOffset{250}), 50);
 }
 
 TEST_F(StorageDictionarySegmentTest, GetValueByValueId) {
@@ -110,4 +131,33 @@ TEST_F(StorageDictionarySegmentTest, GetValueByValueId) {
   EXPECT_EQ(int_dictionary_segment->value_by_value_id(ValueID{0}), 1);
 }
 
+TEST_F(StorageDictionarySegmentTest, CompressSegmentBitPacked) {
+  // 300 distinct values only need 9 bits per value id instead of the 16 bits of a FixedSizeAttributeVector<uint16_t>
+  for (int i = 0; i < 600; ++i) vc_int->append(i % 300);
+  auto dict_col = std::make_shared<DictionarySegment<int>>(vc_int, AttributeVectorEncoding::BitPacked);
+
+  const auto attribute_vector = std::dynamic_pointer_cast<const BitPackedAttributeVector>(dict_col->attribute_vector());
+  ASSERT_TRUE(attribute_vector);
+  EXPECT_EQ(attribute_vector->bit_width(), 9u);
+  EXPECT_EQ(dict_col->unique_values_count(), 300u);
+  EXPECT_EQ(dict_col->get(299), 299);
+  EXPECT_EQ(dict_col->get(301), 1);
+  const auto dictionary_bytes = sizeof(SegmentBuffer<int>) + 300 * sizeof(int);
+  EXPECT_EQ(dict_col->estimate_memory_usage(), sizeof(DictionarySegment<int>) + 2 * SHARED_PTR_CONTROL_BLOCK_SIZE +
+                                                   dictionary_bytes + attribute_vector->estimate_memory_usage());
+}
+
+TEST_F(StorageDictionarySegmentTest, Statistics) {
+  for (auto value : {7, 3, 9, 3, 7}) vc_int->append(value);
+  const auto dict_col = DictionarySegment<int>(vc_int);
+
+  const auto statistics = dict_col.compute_statistics();
+  ASSERT_TRUE(statistics);
+  EXPECT_EQ(statistics->min, AllTypeVariant{3});
+  EXPECT_EQ(statistics->max, AllTypeVariant{9});
+  EXPECT_EQ(statistics->distinct_count, 3u);
+
+  EXPECT_FALSE(DictionarySegment<int>(std::make_shared<ValueSegment<int>>()).compute_statistics());
+}
+
 }  // namespace opossum
@@ -0,0 +1,99 @@
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/dictionary_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/value_segment.hpp"
+#include "type_cast.hpp"
+
+namespace opossum {
+
+class StorageFrameOfReferenceSegmentTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueSegment<int32_t>> vc_int = std::make_shared<ValueSegment<int32_t>>();
+  std::shared_ptr<ValueSegment<int64_t>> vc_long = std::make_shared<ValueSegment<int64_t>>();
+};
+
+TEST_F(StorageFrameOfReferenceSegmentTest, CompressSegmentInt) {
+  for (const auto value : {1'000'004, 1'000'000, 1'000'002, 1'000'007}) vc_int->append(value);
+  auto for_col = std::make_shared<FrameOfReferenceSegment<int32_t>>(vc_int);
+
+  EXPECT_EQ(for_col->size(), 4u);
+  const auto& block_minima = *for_col->block_minima();
+  EXPECT_EQ(std::vector<int32_t>(block_minima.cbegin(), block_minima.cend()), (std::vector<int32_t>{1'000'000}));
+  // Offsets up to 7 need three bits
+  EXPECT_EQ(for_col->offsets()->bit_width(), 3u);
+  EXPECT_EQ(for_col->offsets()->get(0), ValueID{4});
+  EXPECT_EQ(for_col->get(ChunkOffset{3}), 1'000'007);
+  EXPECT_EQ(type_cast<int32_t>((*for_col)[ChunkOffset{1}]), 1'000'000);
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, MultipleBlocks) {
+  // Each block covers a different range of values, negative ones included
+  constexpr auto block_size = FrameOfReferenceSegment<int64_t>::BLOCK_SIZE;
+  for (auto index = int64_t{0}; index < 5000; ++index) vc_long->append((index / 2048) * 1'000'000'000'000 - index % 9);
+
+  const auto for_col = FrameOfReferenceSegment<int64_t>(vc_long);
+  ASSERT_EQ(for_col.block_minima()->size(), 3u);
+  EXPECT_EQ((*for_col.block_minima())[1], 1'000'000'000'000 - 8);
+  EXPECT_EQ(for_col.offsets()->bit_width(), 4u);
+
+  std::vector<int64_t> block(block_size);
+  EXPECT_EQ(for_col.decode_block(2, block.data()), 5000u - 2 * block_size);
+  EXPECT_EQ(block[0], 2'000'000'000'000 - static_cast<int64_t>(2 * block_size % 9));
+
+  for (ChunkOffset chunk_offset{0}; chunk_offset < vc_long->size(); ++chunk_offset) {
+    EXPECT_EQ(for_col.get(chunk_offset), vc_long->values()[chunk_offset]);
+  }
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, CompressDictionarySegment) {
+  for (auto value = 0; value < 10'000; ++value) vc_int->append(value % 100);
+  const auto dictionary_segment = std::make_shared<DictionarySegment<int32_t>>(vc_int);
+
+  const auto for_col = FrameOfReferenceSegment<int32_t>(dictionary_segment);
+  EXPECT_EQ(for_col.get(ChunkOffset{9999}), 99);
+
+  // Seven bits per value instead of four bytes, enough values to outweigh the size of the segment objects
+  EXPECT_LT(for_col.estimate_memory_usage(), vc_int->estimate_memory_usage() / 4);
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, CanEncode) {
+  vc_long->append(std::numeric_limits<int64_t>::min());
+  vc_long->append(std::numeric_limits<int64_t>::max());
+  EXPECT_FALSE(FrameOfReferenceSegment<int64_t>::can_encode(*vc_long));
+  EXPECT_THROW(FrameOfReferenceSegment<int64_t>{vc_long}, std::logic_error);
+
+  vc_int->append(std::numeric_limits<int32_t>::min());
+  vc_int->append(std::numeric_limits<int32_t>::min() + (1 << 30));
+  EXPECT_TRUE(FrameOfReferenceSegment<int32_t>::can_encode(*vc_int));
+  EXPECT_EQ(FrameOfReferenceSegment<int32_t>(vc_int).get(ChunkOffset{1}),
+            std::numeric_limits<int32_t>::min() + (1 << 30));
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, EmptySegment) {
+  const auto for_col = FrameOfReferenceSegment<int32_t>(vc_int);
+  EXPECT_EQ(for_col.size(), 0u);
+  EXPECT_TRUE(for_col.block_minima()->empty());
+  EXPECT_EQ(for_col.compute_statistics(), nullptr);
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, IsImmutable) {
+  vc_int->append(1);
+  const auto for_col = std::make_shared<FrameOfReferenceSegment<int32_t>>(vc_int);
+  EXPECT_THROW(for_col->append(2), std::exception);
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, Statistics) {
+  for (auto index = 0; index < 3000; ++index) vc_int->append(index % 2 == 0 ? -index : index);
+  const auto statistics = FrameOfReferenceSegment<int32_t>(vc_int).compute_statistics();
+  ASSERT_TRUE(statistics);
+  EXPECT_EQ(statistics->min, AllTypeVariant{-2998});
+  EXPECT_EQ(statistics->max, AllTypeVariant{2999});
+}
+
+}  // namespace opossum
@@ -0,0 +1,106 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/dictionary_segment.hpp"
+#include "storage/front_coded_dictionary.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageFrontCodedDictionaryTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // URLs that share long prefixes, spread over several blocks
+    for (auto index = 0; index < 100; ++index) {
+      _values.push_back("https://example.com/products/" + std::to_string(index * 7) + "/details");
+    }
+    _values.emplace_back("");
+    _values.emplace_back(200, 'x');
+    std::sort(_values.begin(), _values.end());
+  }
+
+  std::vector<std::string> _values;
+};
+
+TEST_F(StorageFrontCodedDictionaryTest, Access) {
+  const auto dictionary = FrontCodedDictionary{_values};
+  ASSERT_EQ(dictionary.size(), _values.size());
+  EXPECT_EQ(dictionary.block_offsets().size(), 7u);
+  for (auto index = size_t{0}; index < _values.size(); ++index) EXPECT_EQ(dictionary[index], _values[index]);
+  EXPECT_EQ(dictionary.front(), "");
+  EXPECT_EQ(dictionary.back(), std::string(200, 'x'));
+  EXPECT_EQ(dictionary.decode(), _values);
+  EXPECT_THROW(dictionary.at(_values.size()), std::out_of_range);
+}
+
+TEST_F(StorageFrontCodedDictionaryTest, Bounds) {
+  const auto dictionary = FrontCodedDictionary{_values};
+  auto search_values = _values;
+  for (const auto& value : _values) {
+    search_values.push_back(value + "!");
+    if (!value.empty()) search_values.push_back(value.substr(0, value.size() - 1));
+  }
+  search_values.emplace_back("zzz");
+
+  for (const auto& search_value : search_values) {
+    const auto expected_lower_bound = std::lower_bound(_values.cbegin(), _values.cend(), search_value);
+    const auto expected_upper_bound = std::upper_bound(_values.cbegin(), _values.cend(), search_value);
+    EXPECT_EQ(dictionary.lower_bound(search_value),
+              static_cast<size_t>(std::distance(_values.cbegin(), expected_lower_bound)));
+    EXPECT_EQ(dictionary.upper_bound(search_value),
+              static_cast<size_t>(std::distance(_values.cbegin(), expected_upper_bound)));
+  }
+}
+
+TEST_F(StorageFrontCodedDictionaryTest, SharedPrefixesAreStoredOnce) {
+  const auto dictionary = FrontCodedDictionary{_values};
+  auto total_length = size_t{0};
+  for (const auto& value : _values) total_length += value.size();
+  EXPECT_LT(dictionary.bytes().size(), total_length / 2);
+  EXPECT_LT(dictionary.estimate_memory_usage(), _values.size() * sizeof(std::string));
+}
+
+TEST_F(StorageFrontCodedDictionaryTest, EmptyDictionary) {
+  const auto dictionary = FrontCodedDictionary{std::vector<std::string>{}};
+  EXPECT_TRUE(dictionary.empty());
+  EXPECT_EQ(dictionary.lower_bound("a"), 0u);
+  EXPECT_EQ(dictionary.upper_bound("a"), 0u);
+  EXPECT_TRUE(dictionary.decode().empty());
+}
+
+TEST_F(StorageFrontCodedDictionaryTest, FromEncodedBuffer) {
+  const auto dictionary = FrontCodedDictionary{_values};
+  auto bytes = dictionary.bytes();
+  auto block_offsets = dictionary.block_offsets();
+  const auto copy = FrontCodedDictionary{std::move(bytes), std::move(block_offsets), dictionary.size()};
+  EXPECT_EQ(copy.decode(), _values);
+
+  const auto& offsets = dictionary.block_offsets();
+  auto wrong_offsets = SegmentBuffer<uint64_t>{pmr_vector<uint64_t>(offsets.cbegin(), offsets.cend() - 1)};
+  EXPECT_THROW(FrontCodedDictionary(SegmentBuffer<char>{dictionary.bytes()}, std::move(wrong_offsets), _values.size()),
+               std::logic_error);
+}
+
+TEST_F(StorageFrontCodedDictionaryTest, StringDictionarySegment) {
+  auto value_segment = std::make_shared<ValueSegment<std::string>>();
+  for (auto index = size_t{0}; index < 500; ++index) value_segment->append(_values[index * 13 % _values.size()]);
+
+  const auto segment = DictionarySegment<std::string>{value_segment};
+  EXPECT_EQ(segment.unique_values_count(), _values.size());
+  EXPECT_EQ(*segment.decoded_dictionary(), pmr_vector<std::string>(_values.cbegin(), _values.cend()));
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < value_segment->size(); ++chunk_offset) {
+    EXPECT_EQ(segment.get(chunk_offset), value_segment->values()[chunk_offset]);
+  }
+  EXPECT_EQ(segment.lower_bound(_values[20]), ValueID{20});
+  EXPECT_EQ(segment.upper_bound(_values[20]), ValueID{21});
+  EXPECT_EQ(segment.lower_bound(std::string{"zzz"}), INVALID_VALUE_ID);
+  EXPECT_EQ(segment.value_by_value_id(ValueID{3}), _values[3]);
+}
+
+}  // namespace opossum
@@ -0,0 +1,97 @@
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/pos_list.hpp"
+#include "types.hpp"
+#include "utils/memory_usage.hpp"
+
+namespace opossum {
+
+class StoragePosListTest : public BaseTest {};
+
+TEST_F(StoragePosListTest, SingleChunkRange) {
+  auto pos_list = PosList{ChunkID{2}};
+  EXPECT_TRUE(pos_list.empty());
+  for (auto chunk_offset = ChunkOffset{3}; chunk_offset < 6; ++chunk_offset) pos_list.push_back(chunk_offset);
+  pos_list.push_back_range(6, 9);
+  pos_list.push_back(RowID{ChunkID{2}, 9});
+
+  EXPECT_TRUE(pos_list.references_single_chunk());
+  EXPECT_EQ(pos_list.common_chunk_id(), ChunkID{2});
+  EXPECT_TRUE(pos_list.is_range());
+  EXPECT_EQ(pos_list.size(), 7u);
+  EXPECT_EQ(pos_list[0], (RowID{ChunkID{2}, 3}));
+  EXPECT_EQ(pos_list[6], (RowID{ChunkID{2}, 9}));
+  // Only the bounds of the range are stored
+  EXPECT_EQ(pos_list.estimate_memory_usage(), sizeof(PosList));
+}
+
+TEST_F(StoragePosListTest, SingleChunkOffsets) {
+  auto pos_list = PosList{ChunkID{1}};
+  pos_list.push_back(1);
+  pos_list.push_back(2);
+  pos_list.push_back(5);
+  pos_list.push_back_range(7, 9);
+
+  EXPECT_TRUE(pos_list.references_single_chunk());
+  EXPECT_FALSE(pos_list.is_range());
+  EXPECT_EQ(pos_list, (PosList{RowID{ChunkID{1}, 1}, RowID{ChunkID{1}, 2}, RowID{ChunkID{1}, 5},
+                               RowID{ChunkID{1}, 7}, RowID{ChunkID{1}, 8}}));
+
+  // The offsets take four bytes per position, RowIDs take eight
+  auto large_pos_list = PosList{ChunkID{0}};
+  auto row_ids = std::vector<RowID>{};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 1000; chunk_offset += 2) {
+    large_pos_list.push_back(chunk_offset);
+    row_ids.push_back(RowID{ChunkID{0}, chunk_offset});
+  }
+  row_ids.shrink_to_fit();
+  EXPECT_LE(large_pos_list.estimate_memory_usage() - sizeof(PosList), 2 * 500 * sizeof(ChunkOffset));
+  EXPECT_EQ(PosList{std::move(row_ids)}.estimate_memory_usage(), sizeof(PosList) + 500 * sizeof(RowID));
+}
+
+TEST_F(StoragePosListTest, RowIDs) {
+  const auto pos_list = PosList{RowID{ChunkID{1}, 4}, NULL_ROW_ID, RowID{ChunkID{0}, 2}};
+  EXPECT_FALSE(pos_list.references_single_chunk());
+  EXPECT_EQ(pos_list.size(), 3u);
+  EXPECT_EQ(pos_list[1], NULL_ROW_ID);
+
+  auto row_ids = std::vector<RowID>{};
+  for (const auto row_id : pos_list) row_ids.push_back(row_id);
+  EXPECT_EQ(row_ids, (std::vector<RowID>{RowID{ChunkID{1}, 4}, NULL_ROW_ID, RowID{ChunkID{0}, 2}}));
+}
+
+TEST_F(StoragePosListTest, ForEachChunk) {
+  const auto pos_list = PosList{RowID{ChunkID{1}, 0}, RowID{ChunkID{1}, 2}, NULL_ROW_ID, RowID{ChunkID{0}, 5}};
+  auto runs = std::vector<std::tuple<ChunkID, size_t, size_t, std::vector<ChunkOffset>>>{};
+  const auto collect_runs = [&](const ChunkID chunk_id, const size_t begin_index, const size_t end_index,
+                                const auto& chunk_offset_at) {
+    auto chunk_offsets = std::vector<ChunkOffset>{};
+    for (auto index = begin_index; index < end_index; ++index) chunk_offsets.push_back(chunk_offset_at(index));
+    runs.emplace_back(chunk_id, begin_index, end_index, chunk_offsets);
+  };
+
+  // Runs of NULL_ROW_ID are skipped
+  pos_list.for_each_chunk(collect_runs);
+  ASSERT_EQ(runs.size(), 2u);
+  EXPECT_EQ(runs[0], std::make_tuple(ChunkID{1}, size_t{0}, size_t{2}, std::vector<ChunkOffset>{0, 2}));
+  EXPECT_EQ(runs[1], std::make_tuple(ChunkID{0}, size_t{3}, size_t{4}, std::vector<ChunkOffset>{5}));
+
+  // A single-chunk list is a single run
+  runs.clear();
+  auto range_pos_list = PosList{ChunkID{3}};
+  range_pos_list.push_back_range(10, 13);
+  range_pos_list.for_each_chunk(collect_runs);
+  ASSERT_EQ(runs.size(), 1u);
+  EXPECT_EQ(runs[0], std::make_tuple(ChunkID{3}, size_t{0}, size_t{3}, std::vector<ChunkOffset>{10, 11, 12}));
+
+  runs.clear();
+  PosList{ChunkID{3}}.for_each_chunk(collect_runs);
+  EXPECT_TRUE(runs.empty());
+}
+
+}  // namespace opossum
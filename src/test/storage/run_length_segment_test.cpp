@@ -0,0 +1,88 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "resolve_type.hpp"
+#include "storage/base_segment.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/value_segment.hpp"
+#include "type_cast.hpp"
+#include "utils/memory_usage.hpp"
+
+namespace opossum {
+
+class StorageRunLengthSegmentTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (const auto& value : {"ok", "ok", "ok", "failed", "ok", "ok"}) vc_str->append(value);
+  }
+
+  std::shared_ptr<ValueSegment<int>> vc_int = std::make_shared<ValueSegment<int>>();
+  std::shared_ptr<ValueSegment<std::string>> vc_str = std::make_shared<ValueSegment<std::string>>();
+};
+
+TEST_F(StorageRunLengthSegmentTest, CompressSegmentString) {
+  auto col = make_shared_by_data_type<BaseSegment, RunLengthSegment>("string", vc_str);
+  auto rle_col = std::dynamic_pointer_cast<RunLengthSegment<std::string>>(col);
+
+  EXPECT_EQ(rle_col->size(), 6u);
+  EXPECT_EQ(rle_col->run_count(), 3u);
+  EXPECT_EQ(*rle_col->values(), (pmr_vector<std::string>{"ok", "failed", "ok"}));
+  const auto& end_positions = *rle_col->end_positions();
+  EXPECT_EQ(std::vector<ChunkOffset>(end_positions.cbegin(), end_positions.cend()),
+            (std::vector<ChunkOffset>{2, 3, 5}));
+}
+
+TEST_F(StorageRunLengthSegmentTest, ArrayAccessOperator) {
+  const auto rle_col = RunLengthSegment<std::string>(vc_str);
+
+  const auto expected_values = std::vector<std::string>{"ok", "ok", "ok", "failed", "ok", "ok"};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < expected_values.size(); ++chunk_offset) {
+    EXPECT_EQ(type_cast<std::string>(rle_col[chunk_offset]), expected_values[chunk_offset]);
+    EXPECT_EQ(rle_col.get(chunk_offset), expected_values[chunk_offset]);
+  }
+  EXPECT_EQ(rle_col.run_index(ChunkOffset{3}), 1u);
+  EXPECT_EQ(rle_col.run_index(ChunkOffset{4}), 2u);
+}
+
+TEST_F(StorageRunLengthSegmentTest, CompressDictionarySegment) {
+  for (auto value = 0; value < 1000; ++value) vc_int->append(value / 100);
+  const auto dictionary_segment = std::make_shared<DictionarySegment<int>>(vc_int);
+
+  const auto rle_col = RunLengthSegment<int>(dictionary_segment);
+  EXPECT_EQ(rle_col.size(), 1000u);
+  EXPECT_EQ(rle_col.run_count(), 10u);
+  EXPECT_EQ(rle_col.get(ChunkOffset{999}), 9);
+
+  // Ten runs are much smaller than 1000 values
+  EXPECT_EQ(rle_col.estimate_memory_usage(), sizeof(RunLengthSegment<int>) +
+                                                2 * SHARED_PTR_CONTROL_BLOCK_SIZE + sizeof(SegmentBuffer<int>) +
+                                                sizeof(SegmentBuffer<ChunkOffset>) + 10 * sizeof(int) +
+                                                10 * sizeof(ChunkOffset));
+  EXPECT_LT(rle_col.estimate_memory_usage(), vc_int->estimate_memory_usage());
+}
+
+TEST_F(StorageRunLengthSegmentTest, EmptySegment) {
+  const auto rle_col = RunLengthSegment<int>(vc_int);
+  EXPECT_EQ(rle_col.size(), 0u);
+  EXPECT_EQ(rle_col.run_count(), 0u);
+  EXPECT_EQ(rle_col.compute_statistics(), nullptr);
+}
+
+TEST_F(StorageRunLengthSegmentTest, IsImmutable) {
+  const auto rle_col = std::make_shared<RunLengthSegment<std::string>>(vc_str);
+  EXPECT_THROW(rle_col->append("ok"), std::exception);
+}
+
+TEST_F(StorageRunLengthSegmentTest, Statistics) {
+  const auto statistics = RunLengthSegment<std::string>(vc_str).compute_statistics();
+  ASSERT_TRUE(statistics);
+  EXPECT_EQ(statistics->min, AllTypeVariant{"failed"});
+  EXPECT_EQ(statistics->max, AllTypeVariant{"ok"});
+}
+
+}  // namespace opossum
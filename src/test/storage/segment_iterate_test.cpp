@@ -0,0 +1,130 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/dictionary_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class SegmentIterateTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _value_segment = std::make_shared<ValueSegment<std::string>>();
+    for (const auto& value : {"Bill", "Steve", "Alexander", "Steve", "Hasso", "Bill"}) _value_segment->append(value);
+  }
+
+  template <typename T>
+  std::vector<std::pair<T, ChunkOffset>> _iterate(const BaseSegment& segment) {
+    std::vector<std::pair<T, ChunkOffset>> result;
+    segment_iterate<T>(segment, [&](const T& value, const ChunkOffset chunk_offset) {
+      result.emplace_back(value, chunk_offset);
+    });
+    return result;
+  }
+
+  std::shared_ptr<ValueSegment<std::string>> _value_segment;
+  const std::vector<std::pair<std::string, ChunkOffset>> _expected_values{
+      {"Bill", 0}, {"Steve", 1}, {"Alexander", 2}, {"Steve", 3}, {"Hasso", 4}, {"Bill", 5}};
+};
+
+TEST_F(SegmentIterateTest, ValueSegment) { EXPECT_EQ(_iterate<std::string>(*_value_segment), _expected_values); }
+
+TEST_F(SegmentIterateTest, DictionarySegment) {
+  const auto dictionary_segment = DictionarySegment<std::string>(_value_segment);
+  EXPECT_EQ(_iterate<std::string>(dictionary_segment), _expected_values);
+}
+
+TEST_F(SegmentIterateTest, BitPackedDictionarySegment) {
+  // More than one decoded block of value ids
+  auto value_segment = std::make_shared<ValueSegment<int32_t>>();
+  for (auto value = 0; value < 3000; ++value) value_segment->append(value % 7);
+
+  const auto dictionary_segment = DictionarySegment<int32_t>(value_segment, AttributeVectorEncoding::BitPacked);
+  const auto values = _iterate<int32_t>(dictionary_segment);
+  ASSERT_EQ(values.size(), 3000u);
+  for (ChunkOffset chunk_offset{0}; chunk_offset < values.size(); ++chunk_offset) {
+    EXPECT_EQ(values[chunk_offset], std::make_pair(static_cast<int32_t>(chunk_offset % 7), chunk_offset));
+  }
+}
+
+TEST_F(SegmentIterateTest, RunLengthSegment) {
+  const auto run_length_segment = RunLengthSegment<std::string>(_value_segment);
+  EXPECT_EQ(_iterate<std::string>(run_length_segment), _expected_values);
+}
+
+TEST_F(SegmentIterateTest, FrameOfReferenceSegment) {
+  // More than one block
+  auto value_segment = std::make_shared<ValueSegment<int64_t>>();
+  for (auto value = int64_t{0}; value < 3000; ++value) value_segment->append(value * 3 - 1000);
+
+  const auto frame_of_reference_segment = FrameOfReferenceSegment<int64_t>(value_segment);
+  const auto values = _iterate<int64_t>(frame_of_reference_segment);
+  ASSERT_EQ(values.size(), 3000u);
+  for (ChunkOffset chunk_offset{0}; chunk_offset < values.size(); ++chunk_offset) {
+    EXPECT_EQ(values[chunk_offset], std::make_pair(int64_t{chunk_offset} * 3 - 1000, chunk_offset));
+  }
+}
+
+TEST_F(SegmentIterateTest, ReferenceSegment) {
+  auto table = std::make_shared<Table>(2);
+  table->add_column("a", "int");
+  for (auto value = 0; value < 6; ++value) table->append({value * 10});
+  table->compress_chunk(ChunkID{1});
+
+  // The positions are not ordered by chunk and visit the value segments as well as the dictionary segment
+  const auto pos_list = std::make_shared<PosList>(PosList{RowID{ChunkID{2}, 1}, RowID{ChunkID{0}, 0},
+                                                          RowID{ChunkID{1}, 1}, RowID{ChunkID{1}, 0}});
+  const auto reference_segment = ReferenceSegment(table, ColumnID{0}, pos_list);
+
+  const auto expected_values = std::vector<std::pair<int32_t, ChunkOffset>>{{50, 0}, {0, 1}, {30, 2}, {20, 3}};
+  EXPECT_EQ(_iterate<int32_t>(reference_segment), expected_values);
+}
+
+TEST_F(SegmentIterateTest, ReferenceSegmentToRunLengthSegment) {
+  auto table = std::make_shared<Table>(10);
+  table->add_column("a", "int");
+  for (auto value = 0; value < 10; ++value) table->append({value / 3});
+  auto chunk = Chunk{};
+  chunk.add_segment(
+      std::make_shared<RunLengthSegment<int32_t>>(table->get_chunk(ChunkID{0})->get_segment(ColumnID{0})));
+  auto run_length_table = std::make_shared<Table>(10);
+  run_length_table->add_column_definition("a", "int");
+  run_length_table->emplace_chunk(std::move(chunk));
+
+  // Ascending positions reuse the previous run, the others have to search for their run
+  const auto pos_list = std::make_shared<PosList>(PosList{RowID{ChunkID{0}, 1}, RowID{ChunkID{0}, 2},
+                                                          RowID{ChunkID{0}, 9}, RowID{ChunkID{0}, 4}});
+  const auto reference_segment = ReferenceSegment(run_length_table, ColumnID{0}, pos_list);
+
+  const auto expected_values = std::vector<std::pair<int32_t, ChunkOffset>>{{0, 0}, {0, 1}, {3, 2}, {1, 3}};
+  EXPECT_EQ(_iterate<int32_t>(reference_segment), expected_values);
+}
+
+TEST_F(SegmentIterateTest, ReferenceSegmentToFrameOfReferenceSegment) {
+  auto table = std::make_shared<Table>(10);
+  table->add_column("a", "int");
+  for (auto value = 0; value < 10; ++value) table->append({value * 7});
+  table->compress_chunk(ChunkID{0}, SegmentEncoding::FrameOfReference);
+
+  const auto pos_list = std::make_shared<PosList>(PosList{RowID{ChunkID{0}, 9}, NULL_ROW_ID, RowID{ChunkID{0}, 2}});
+  const auto reference_segment = ReferenceSegment(table, ColumnID{0}, pos_list);
+
+  const auto expected_values = std::vector<std::pair<int32_t, ChunkOffset>>{{63, 0}, {14, 2}};
+  EXPECT_EQ(_iterate<int32_t>(reference_segment), expected_values);
+}
+
+TEST_F(SegmentIterateTest, WrongDataType) {
+  EXPECT_THROW(_iterate<int32_t>(*_value_segment), std::logic_error);
+}
+
+}  // namespace opossum
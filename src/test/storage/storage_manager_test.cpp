@@ -1,5 +1,6 @@
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "../base_test.hpp"
@@ -7,6 +8,7 @@
 
 #include "../lib/storage/storage_manager.hpp"
 #include "../lib/storage/table.hpp"
+#include "../lib/utils/memory_usage.hpp"
 
 namespace opossum {
 
@@ -59,23 +61,108 @@ TEST_F(StorageStorageManagerTest, GetTableNames) {
 
 TEST_F(StorageStorageManagerTest, Print) {
   auto& sm = StorageManager::get();
+  const auto first_table = sm.get_table("first_table");
+  const auto second_table = sm.get_table("second_table");
+  const auto table_line = [](const std::string& name, const std::shared_ptr<Table>& table, const std::string& counts) {
+    return name + ", " + counts + ", " + std::to_string(table->estimate_memory_usage()) + " bytes\n";
+  };
+
   std::ostringstream oss;
   sm.print(oss);
-  EXPECT_EQ(oss.str(), "first_table, 0, 0, 1\nsecond_table, 0, 0, 1\n");
-  sm.get_table("second_table")->add_column("column_name", "string");
+  EXPECT_EQ(oss.str(), table_line("first_table", first_table, "0, 0, 1") +
+                           table_line("second_table", second_table, "0, 0, 1"));
+  second_table->add_column("column_name", "string");
   oss.str("");
   sm.print(oss);
   // Column count of "second_table" has to have increased (from 0 to 1)
-  EXPECT_EQ(oss.str(), "first_table, 0, 0, 1\nsecond_table, 1, 0, 1\n");
-  sm.get_table("second_table")->append({"Hello world"});
-  sm.get_table("second_table")->append({"Hello world"});
-  sm.get_table("second_table")->append({"Hello world"});
-  sm.get_table("second_table")->append({"Hello world"});
-  sm.get_table("second_table")->append({"Hello world"});
+  EXPECT_EQ(oss.str().substr(0, oss.str().find("  column_name")),
+            table_line("first_table", first_table, "0, 0, 1") + table_line("second_table", second_table, "1, 0, 1"));
+  second_table->append({"Hello world"});
+  second_table->append({"Hello world"});
+  second_table->append({"Hello world"});
+  second_table->append({"Hello world"});
+  second_table->append({"Hello world"});
+  second_table->compress_chunk(ChunkID{0}, AttributeVectorEncoding::BitPacked);
   oss.str("");
   sm.print(oss);
   // Row count of "second_table" has to increase from 0 to 5; chunk count has to increase from 1 to 2
-  EXPECT_EQ(oss.str(), "first_table, 0, 0, 1\nsecond_table, 1, 5, 2\n");
+  EXPECT_EQ(oss.str().substr(0, oss.str().find("  column_name")),
+            table_line("first_table", first_table, "0, 0, 1") + table_line("second_table", second_table, "1, 5, 2"));
+
+  // The bytes of the column are broken down by encoding
+  auto dictionary_bytes = SHARED_PTR_CONTROL_BLOCK_SIZE;
+  dictionary_bytes += second_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0})->estimate_memory_usage();
+  auto value_bytes = SHARED_PTR_CONTROL_BLOCK_SIZE;
+  value_bytes += second_table->get_chunk(ChunkID{1})->get_segment(ColumnID{0})->estimate_memory_usage();
+  EXPECT_NE(oss.str().find("\n  column_name (string), " + std::to_string(dictionary_bytes + value_bytes) +
+                           " bytes, Dictionary (BitPacked): " + std::to_string(dictionary_bytes) +
+                           " bytes in 1 segment, Value: " + std::to_string(value_bytes) + " bytes in 1 segment\n"),
+            std::string::npos);
+}
+
+TEST_F(StorageStorageManagerTest, MemoryUsage) {
+  auto& sm = StorageManager::get();
+  sm.get_table("second_table")->add_column("a", "int");
+  sm.get_table("second_table")->append({1});
+  const auto first_table_bytes = sm.get_table("first_table")->estimate_memory_usage();
+  EXPECT_EQ(sm.estimate_memory_usage(), first_table_bytes + sm.get_table("second_table")->estimate_memory_usage());
+}
+
+TEST_F(StorageStorageManagerTest, SnapshotKeepsDroppedTableAlive) {
+  auto& sm = StorageManager::get();
+  const auto snapshot = sm.snapshot();
+  const auto table = sm.get_table("first_table");
+  sm.drop_table("first_table");
+  sm.add_table("third_table", std::make_shared<Table>());
+
+  EXPECT_FALSE(sm.has_table("first_table"));
+  EXPECT_EQ(snapshot->size(), 2u);
+  EXPECT_EQ(snapshot->at("first_table"), table);
+  EXPECT_FALSE(snapshot->count("third_table"));
+}
+
+TEST_F(StorageStorageManagerTest, SnapshotIsReusedUntilTheCatalogChanges) {
+  auto& sm = StorageManager::get();
+  const auto snapshot = sm.snapshot();
+  EXPECT_EQ(sm.snapshot(), snapshot);
+
+  // A change by another thread is visible once it is done
+  std::thread([&]() { sm.add_table("third_table", std::make_shared<Table>()); }).join();
+  EXPECT_NE(sm.snapshot(), snapshot);
+  EXPECT_TRUE(sm.has_table("third_table"));
+  EXPECT_FALSE(snapshot->count("third_table"));
+}
+
+TEST_F(StorageStorageManagerTest, ConcurrentAccess) {
+  auto& sm = StorageManager::get();
+  constexpr auto table_count = 200;
+
+  std::vector<std::thread> readers;
+  for (auto reader_index = 0; reader_index < 4; ++reader_index) {
+    readers.emplace_back([&]() {
+      for (auto iteration = 0; iteration < 1000; ++iteration) {
+        EXPECT_TRUE(sm.get_table("second_table"));
+        EXPECT_GE(sm.table_names().size(), 1u);
+      }
+    });
+  }
+
+  std::vector<std::thread> writers;
+  for (auto writer_index = 0; writer_index < 2; ++writer_index) {
+    writers.emplace_back([&, writer_index]() {
+      for (auto table_index = 0; table_index < table_count; ++table_index) {
+        const auto name = "table_" + std::to_string(writer_index) + "_" + std::to_string(table_index);
+        sm.add_table(name, std::make_shared<Table>());
+        if (table_index % 2 == 0) sm.drop_table(name);
+      }
+    });
+  }
+
+  for (auto& thread : readers) thread.join();
+  for (auto& thread : writers) thread.join();
+
+  // No change got lost
+  EXPECT_EQ(sm.table_names().size(), 2u + table_count);
 }
 
 }  // namespace opossum
@@ -1,6 +1,9 @@
+#include <algorithm>
+#include <atomic>
 #include <limits>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -8,7 +11,14 @@
 #include "gtest/gtest.h"
 
 #include "../lib/resolve_type.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/frame_of_reference_segment.hpp"
+#include "../lib/storage/reference_segment.hpp"
+#include "../lib/storage/run_length_segment.hpp"
+#include "../lib/storage/segment_arena.hpp"
 #include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+#include "../lib/utils/memory_usage.hpp"
 
 namespace opossum {
 
@@ -83,6 +93,47 @@ TEST_F(StorageTableTest, MoveConstructor) {
   EXPECT_EQ(t2.chunk_count(), 1u);
 }
 
+TEST_F(StorageTableTest, AppendColumns) {
+  t.append({1, "one"});
+  std::vector<int32_t> int_values{2, 3, 4, 5, 6};
+  std::vector<std::string> string_values{"two", "three", "four", "five", "six"};
+  t.append_columns({std::move(int_values), std::move(string_values)});
+
+  // The first chunk is filled up before new chunks are created
+  EXPECT_EQ(t.row_count(), 6u);
+  EXPECT_EQ(t.chunk_count(), 3u);
+  for (ChunkID chunk_id{0}; chunk_id < t.chunk_count(); ++chunk_id) EXPECT_EQ(t.get_chunk(chunk_id)->size(), 2u);
+  EXPECT_EQ((*t.get_chunk(ChunkID{1})->get_segment(ColumnID{1}))[0], AllTypeVariant{"three"});
+  EXPECT_EQ((*t.get_chunk(ChunkID{2})->get_segment(ColumnID{0}))[1], AllTypeVariant{6});
+
+  // Appending row by row continues after the appended columns
+  t.append({7, "seven"});
+  EXPECT_EQ(t.chunk_count(), 4u);
+
+  EXPECT_THROW(t.append_columns({std::vector<int32_t>{1}, std::vector<float>{1.0f}}), std::logic_error);
+  EXPECT_THROW(t.append_columns({std::vector<int32_t>{1, 2}, std::vector<std::string>{"one"}}), std::logic_error);
+  EXPECT_THROW(t.append_columns({std::vector<int32_t>{1}}), std::logic_error);
+  EXPECT_EQ(t.row_count(), 7u);
+}
+
+TEST_F(StorageTableTest, AppendColumnsIntoSingleChunk) {
+  Table table;
+  table.add_column("a", "double");
+  table.append_columns({std::vector<double>(1000, 0.5)});
+  EXPECT_EQ(table.chunk_count(), 1u);
+  EXPECT_EQ(table.row_count(), 1000u);
+}
+
+TEST_F(StorageTableTest, AppendColumnsWithoutChunkSizeLimit) {
+  Table table(0);
+  table.add_column("a", "int");
+  table.append_columns({std::vector<int32_t>{1, 2, 3}});
+  table.append_columns({std::vector<int32_t>{4, 5}});
+  EXPECT_EQ(table.row_count(), 5u);
+  EXPECT_EQ(table.chunk_count(), 2u);
+  EXPECT_EQ(table.get_chunk(ChunkID{1})->size(), 5u);
+}
+
 TEST_F(StorageTableTest, CompressChunk) {
   t.append({4, "Hello,"});
   t.append({6, "world"});
@@ -91,9 +142,375 @@ TEST_F(StorageTableTest, CompressChunk) {
   t.compress_chunk(ChunkID{0});
 
   EXPECT_EQ(t.chunk_count(), 1u);
-  EXPECT_EQ(type_cast<int>(t.get_chunk(ChunkID{0}).get_segment(ColumnID{0})->operator[](0)), 4);
-  EXPECT_EQ(type_cast<std::string>(t.get_chunk(ChunkID{0}).get_segment(ColumnID{1})->operator[](0)),
+  EXPECT_EQ(type_cast<int>(t.get_chunk(ChunkID{0})->get_segment(ColumnID{0})->operator[](0)), 4);
+  EXPECT_EQ(type_cast<std::string>(t.get_chunk(ChunkID{0})->get_segment(ColumnID{1})->operator[](0)),
             "Hello,");
 }
 
+TEST_F(StorageTableTest, CompressChunks) {
+  for (auto value = 0; value < 5; ++value) t.append({value, std::to_string(value)});
+  EXPECT_EQ(t.chunk_count(), 3u);
+
+  t.compress_chunks(ChunkID{1}, ChunkID{3});
+
+  EXPECT_EQ(t.chunk_count(), 3u);
+  EXPECT_TRUE(std::dynamic_pointer_cast<ValueSegment<int>>(t.get_chunk(ChunkID{0})->get_segment(ColumnID{0})));
+  for (auto chunk_id = ChunkID{1}; chunk_id < t.chunk_count(); ++chunk_id) {
+    const auto chunk = t.get_chunk(chunk_id);
+    EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int>>(chunk->get_segment(ColumnID{0})));
+    EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<std::string>>(chunk->get_segment(ColumnID{1})));
+  }
+  EXPECT_EQ(type_cast<int>((*t.get_chunk(ChunkID{2})->get_segment(ColumnID{0}))[0]), 4);
+  EXPECT_EQ(type_cast<std::string>((*t.get_chunk(ChunkID{1})->get_segment(ColumnID{1}))[1]), "3");
+}
+
+TEST_F(StorageTableTest, CompressChunkWithEncoding) {
+  for (auto value = 0; value < 6; ++value) t.append({value, "same"});
+
+  t.compress_chunk(ChunkID{0}, SegmentEncoding::RunLength);
+  EXPECT_TRUE(std::dynamic_pointer_cast<RunLengthSegment<int>>(t.get_chunk(ChunkID{0})->get_segment(ColumnID{0})));
+  EXPECT_TRUE(
+      std::dynamic_pointer_cast<RunLengthSegment<std::string>>(t.get_chunk(ChunkID{0})->get_segment(ColumnID{1})));
+
+  // Strings cannot be frame-of-reference encoded and fall back to dictionary encoding
+  t.compress_chunk(ChunkID{1},
+                   SegmentEncodingSpec{SegmentEncoding::FrameOfReference, AttributeVectorEncoding::BitPacked});
+  EXPECT_TRUE(
+      std::dynamic_pointer_cast<FrameOfReferenceSegment<int>>(t.get_chunk(ChunkID{1})->get_segment(ColumnID{0})));
+  const auto dictionary_segment =
+      std::dynamic_pointer_cast<DictionarySegment<std::string>>(t.get_chunk(ChunkID{1})->get_segment(ColumnID{1}));
+  ASSERT_TRUE(dictionary_segment);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const BitPackedAttributeVector>(dictionary_segment->attribute_vector()));
+
+  // So do integer columns whose values are too far apart
+  auto wide_table = Table{2};
+  wide_table.add_column("a", "long");
+  wide_table.append({std::numeric_limits<int64_t>::min()});
+  wide_table.append({std::numeric_limits<int64_t>::max()});
+  wide_table.compress_chunk(ChunkID{0}, SegmentEncoding::FrameOfReference);
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int64_t>>(
+      wide_table.get_chunk(ChunkID{0})->get_segment(ColumnID{0})));
+
+  EXPECT_EQ(type_cast<int>((*t.get_chunk(ChunkID{1})->get_segment(ColumnID{0}))[1]), 3);
+  EXPECT_EQ(type_cast<std::string>((*t.get_chunk(ChunkID{0})->get_segment(ColumnID{1}))[1]), "same");
+}
+
+TEST_F(StorageTableTest, CompressTable) {
+  for (auto value = 0; value < 5; ++value) t.append({value, std::to_string(value)});
+  t.compress_chunk(ChunkID{0});
+  const auto compressed_segment = t.get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+
+  const auto duration = t.compress_table();
+  EXPECT_GT(duration.count(), 0);
+
+  // Chunks that are already compressed keep their segments
+  EXPECT_EQ(t.get_chunk(ChunkID{0})->get_segment(ColumnID{0}), compressed_segment);
+  for (auto chunk_id = ChunkID{0}; chunk_id < t.chunk_count(); ++chunk_id) {
+    EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int>>(t.get_chunk(chunk_id)->get_segment(ColumnID{0})));
+  }
+  EXPECT_EQ(t.row_count(), 5u);
+}
+
+TEST_F(StorageTableTest, MemoryUsageCountsSharedPositionListsOnce) {
+  const auto referenced_table = std::make_shared<Table>();
+  referenced_table->add_column("a", "int");
+  referenced_table->add_column("b", "int");
+  referenced_table->append({1, 2});
+  const auto pos_list = std::make_shared<PosList>(std::vector<RowID>{RowID{ChunkID{0}, 0}, RowID{ChunkID{0}, 0}});
+  const auto other_pos_list = std::make_shared<PosList>(std::vector<RowID>{RowID{ChunkID{0}, 0}, RowID{ChunkID{0}, 0}});
+
+  const auto reference_table = [&](const std::shared_ptr<const PosList>& second_pos_list) {
+    auto table = Table{};
+    table.add_column_definition("a", "int");
+    table.add_column_definition("b", "int");
+    for (auto chunk_index = 0; chunk_index < 2; ++chunk_index) {
+      Chunk chunk;
+      chunk.add_segment(std::make_shared<ReferenceSegment>(referenced_table, ColumnID{0}, pos_list));
+      chunk.add_segment(std::make_shared<ReferenceSegment>(referenced_table, ColumnID{1}, second_pos_list));
+      table.emplace_chunk(std::move(chunk));
+    }
+    return table;
+  };
+  const auto pos_list_bytes = SHARED_PTR_CONTROL_BLOCK_SIZE + pos_list->estimate_memory_usage();
+
+  // Both columns share one position list, which both chunks share as well
+  const auto shared = reference_table(pos_list);
+  const auto separate = reference_table(other_pos_list);
+  EXPECT_EQ(separate.get_chunk(ChunkID{0})->estimate_memory_usage(),
+            shared.get_chunk(ChunkID{0})->estimate_memory_usage() + pos_list_bytes);
+  EXPECT_EQ(separate.estimate_memory_usage(), shared.estimate_memory_usage() + pos_list_bytes);
+}
+
+TEST_F(StorageTableTest, CompressedSegmentsOutliveTheirTable) {
+  auto table = std::make_shared<Table>(10);
+  table->add_column("a", "string");
+  for (auto value = 0; value < 10; ++value) table->append({"value" + std::to_string(value % 3)});
+  table->compress_chunk(ChunkID{0}, SegmentEncoding::RunLength);
+  const auto segment = table->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+
+  // The arena of the segment is freed only when the last reference to the segment is gone
+  table.reset();
+  EXPECT_EQ(segment->size(), 10u);
+  EXPECT_EQ(type_cast<std::string>((*segment)[4]), "value1");
+}
+
+TEST_F(StorageTableTest, HandedOutBuffersOutliveTheirSegment) {
+  auto table = std::make_shared<Table>(10);
+  table->add_column("a", "string");
+  table->add_column("b", "int");
+  for (auto value = 0; value < 30; ++value) table->append({"value" + std::to_string(value % 3), value / 4});
+  table->compress_chunk(ChunkID{0});
+  table->compress_chunk(ChunkID{1}, SegmentEncoding::FrameOfReference);
+  table->compress_chunk(ChunkID{2}, SegmentEncoding::RunLength);
+
+  const auto dictionary =
+      std::dynamic_pointer_cast<DictionarySegment<std::string>>(table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  ASSERT_TRUE(dictionary);
+  const auto strings = dictionary->dictionary();
+  const auto value_ids = dictionary->attribute_vector();
+
+  const auto frame_of_reference =
+      std::dynamic_pointer_cast<FrameOfReferenceSegment<int>>(table->get_chunk(ChunkID{1})->get_segment(ColumnID{1}));
+  ASSERT_TRUE(frame_of_reference);
+  const auto block_minima = frame_of_reference->block_minima();
+  const auto offsets = frame_of_reference->offsets();
+
+  const auto run_length =
+      std::dynamic_pointer_cast<RunLengthSegment<int>>(table->get_chunk(ChunkID{2})->get_segment(ColumnID{1}));
+  ASSERT_TRUE(run_length);
+  const auto values = run_length->values();
+  const auto end_positions = run_length->end_positions();
+
+  // Each buffer shares the ownership of its segment's arena, which stays alive without the segment
+  table.reset();
+  EXPECT_EQ(strings->size(), 3u);
+  EXPECT_EQ(strings->at(ValueID{2}), "value2");
+  EXPECT_EQ(value_ids->get(7), ValueID{1});
+  EXPECT_EQ(block_minima->front(), 2);
+  EXPECT_EQ(offsets->get(9), ValueID{2});
+  EXPECT_EQ(std::vector<int>(values->cbegin(), values->cend()), (std::vector<int>{5, 6, 7}));
+  EXPECT_EQ(std::vector<ChunkOffset>(end_positions->cbegin(), end_positions->cend()),
+            (std::vector<ChunkOffset>{3, 7, 9}));
+}
+
+TEST_F(StorageTableTest, MemoryUsageCountsUnusedArenaBytes) {
+  const auto value_segment = std::make_shared<ValueSegment<int>>();
+  for (auto value = 0; value < 100; ++value) value_segment->append(value % 7);
+
+  // The first buffer of the arena is far larger than the segment needs, the rest of it is counted nonetheless
+  const auto arena_size = size_t{1} << 20;
+  const auto in_arena =
+      make_segment_in_arena<DictionarySegment<int>>(arena_size, value_segment, AttributeVectorEncoding::FixedSize);
+  const auto on_heap = DictionarySegment<int>{value_segment};
+  EXPECT_GT(in_arena->estimate_memory_usage(), on_heap.estimate_memory_usage() + arena_size / 2);
+  EXPECT_LT(in_arena->estimate_memory_usage(), on_heap.estimate_memory_usage() + arena_size);
+
+  const auto run_length = make_segment_in_arena<RunLengthSegment<int>>(arena_size, value_segment);
+  EXPECT_GT(run_length->estimate_memory_usage(), arena_size / 2);
+  const auto frame_of_reference = make_segment_in_arena<FrameOfReferenceSegment<int>>(arena_size, value_segment);
+  EXPECT_GT(frame_of_reference->estimate_memory_usage(), arena_size / 2);
+}
+
+TEST_F(StorageTableTest, MemoryUsage) {
+  auto table = Table{100};
+  table.add_column("a", "int");
+  table.add_column("b", "string");
+  const auto long_string = std::string(100, 'x');
+  for (auto index = 0; index < 200; ++index) table.append({index % 3, index % 2 ? long_string : "short"});
+
+  // The table counts its chunks, which count their segments
+  auto chunk_bytes = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    auto segment_bytes = size_t{0};
+    for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+      segment_bytes += chunk->get_segment(column_id)->estimate_memory_usage();
+    }
+    EXPECT_GT(chunk->estimate_memory_usage(), segment_bytes);
+    chunk_bytes += chunk->estimate_memory_usage();
+  }
+  EXPECT_GT(table.estimate_memory_usage(), chunk_bytes);
+
+  // The heap buffers of the 50 long strings in the first chunk are counted
+  EXPECT_GE(table.get_chunk(ChunkID{0})->get_segment(ColumnID{1})->estimate_memory_usage(),
+            100 * sizeof(std::string) + 50 * (long_string.size() + 1));
+
+  // The dictionaries store each string only once
+  const auto uncompressed_bytes = table.estimate_memory_usage();
+  table.compress_table();
+  EXPECT_LT(table.estimate_memory_usage(), uncompressed_bytes / 4);
+}
+
+TEST_F(StorageTableTest, BackgroundCompression) {
+  t.enable_background_compression();
+  for (auto value = 0; value < 4; ++value) t.append({value, std::to_string(value)});
+  const auto value_segment = t.get_chunk(ChunkID{1})->get_segment(ColumnID{1});
+
+  t.append_columns({std::vector<int>{4, 5, 6}, std::vector<std::string>{"4", "5", "6"}});
+  t.wait_for_background_compression();
+
+  // The full chunks are compressed, the last one still receives rows
+  ASSERT_EQ(t.chunk_count(), 4u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < ChunkID{3}; ++chunk_id) {
+    const auto chunk = t.get_chunk(chunk_id);
+    EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int>>(chunk->get_segment(ColumnID{0})));
+    EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<std::string>>(chunk->get_segment(ColumnID{1})));
+    EXPECT_TRUE(chunk->statistics(ColumnID{0}));
+  }
+  EXPECT_TRUE(std::dynamic_pointer_cast<ValueSegment<int>>(t.get_chunk(ChunkID{3})->get_segment(ColumnID{0})));
+  EXPECT_EQ(type_cast<std::string>((*t.get_chunk(ChunkID{2})->get_segment(ColumnID{1}))[1]), "5");
+
+  // Segments that were handed out before the compression stay valid
+  EXPECT_EQ(type_cast<std::string>((*value_segment)[0]), "2");
+
+  t.disable_background_compression();
+  t.append({7, "7"});
+  t.wait_for_background_compression();
+  EXPECT_TRUE(std::dynamic_pointer_cast<ValueSegment<int>>(t.get_chunk(ChunkID{3})->get_segment(ColumnID{0})));
+}
+
+TEST_F(StorageTableTest, BackgroundCompressionWithEncoding) {
+  t.enable_background_compression(SegmentEncoding::RunLength);
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.wait_for_background_compression();
+  EXPECT_TRUE(std::dynamic_pointer_cast<RunLengthSegment<int>>(t.get_chunk(ChunkID{0})->get_segment(ColumnID{0})));
+  EXPECT_EQ(t.row_count(), 2u);
+}
+
+TEST_F(StorageTableTest, AppendConcurrently) {
+  constexpr auto thread_count = 8;
+  constexpr auto rows_per_thread = 1000;
+  auto table = Table{100};
+  table.add_column("a", "int");
+  table.add_column("b", "long");
+
+  // A concurrent reader never sees the row count shrink
+  auto done = std::atomic_bool{false};
+  auto reader = std::thread([&]() {
+    auto previous_row_count = uint64_t{0};
+    while (!done) {
+      const auto row_count = table.row_count();
+      EXPECT_GE(row_count, previous_row_count);
+      previous_row_count = row_count;
+    }
+  });
+
+  std::vector<std::thread> threads;
+  for (auto thread_index = 0; thread_index < thread_count; ++thread_index) {
+    threads.emplace_back([&, thread_index]() {
+      for (auto row = 0; row < rows_per_thread; ++row) {
+        const auto value = thread_index * rows_per_thread + row;
+        table.append_concurrently({value, int64_t{value} * 2});
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  done = true;
+  reader.join();
+
+  ASSERT_EQ(table.row_count(), uint64_t{thread_count * rows_per_thread});
+  ASSERT_EQ(table.chunk_count(), 80u);
+
+  // Every value was appended exactly once and the values of a row stay together
+  std::vector<int> values;
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    EXPECT_TRUE(chunk->statistics(ColumnID{0}));
+    const auto& segment_a = static_cast<const ValueSegment<int>&>(*chunk->get_segment(ColumnID{0}));
+    const auto& segment_b = static_cast<const ValueSegment<int64_t>&>(*chunk->get_segment(ColumnID{1}));
+    ASSERT_EQ(segment_a.size(), 100u);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment_a.size(); ++chunk_offset) {
+      EXPECT_EQ(segment_b.values()[chunk_offset], int64_t{segment_a.values()[chunk_offset]} * 2);
+      values.push_back(segment_a.values()[chunk_offset]);
+    }
+  }
+  std::sort(values.begin(), values.end());
+  for (auto index = 0; index < thread_count * rows_per_thread; ++index) EXPECT_EQ(values[index], index);
+}
+
+TEST_F(StorageTableTest, AppendConcurrentlyNeedsBoundedChunkSize) {
+  auto table = Table{};
+  table.add_column("a", "int");
+  EXPECT_THROW(table.append_concurrently({1}), std::logic_error);
+}
+
+TEST_F(StorageTableTest, MixAppendAndAppendConcurrently) {
+  t.append({1, "a"});
+  t.append_concurrently({2, "b"});
+  t.append_concurrently({3, "c"});
+  // append forwards to append_concurrently once the last chunk is preallocated
+  t.append({4, "d"});
+  t.append_columns({std::vector<int>{5}, std::vector<std::string>{"e"}});
+
+  EXPECT_EQ(t.row_count(), 5u);
+  ASSERT_EQ(t.chunk_count(), 4u);
+  EXPECT_FALSE(t.get_chunk(ChunkID{0})->is_preallocated());
+  EXPECT_TRUE(t.get_chunk(ChunkID{1})->is_preallocated());
+  EXPECT_TRUE(t.get_chunk(ChunkID{2})->is_preallocated());
+  EXPECT_FALSE(t.get_chunk(ChunkID{3})->is_preallocated());
+  EXPECT_EQ(type_cast<std::string>((*t.get_chunk(ChunkID{2})->get_segment(ColumnID{1}))[0]), "d");
+  EXPECT_EQ(type_cast<int>((*t.get_chunk(ChunkID{3})->get_segment(ColumnID{0}))[0]), 5);
+}
+
+TEST_F(StorageTableTest, ChunksOutliveTheirReplacement) {
+  for (auto value = 0; value < 2; ++value) t.append({value, std::to_string(value)});
+  const auto chunk = t.get_chunk(ChunkID{0});
+  t.compress_chunk(ChunkID{0});
+
+  EXPECT_NE(t.get_chunk(ChunkID{0}), chunk);
+  EXPECT_TRUE(std::dynamic_pointer_cast<ValueSegment<int>>(chunk->get_segment(ColumnID{0})));
+  EXPECT_EQ(type_cast<std::string>((*chunk->get_segment(ColumnID{1}))[1]), "1");
+}
+
+TEST_F(StorageTableTest, CompressionSkipsChunksThatReceiveConcurrentAppends) {
+  for (auto value = 0; value < 3; ++value) t.append_concurrently({value, std::to_string(value)});
+  t.compress_table();
+
+  ASSERT_EQ(t.chunk_count(), 2u);
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int>>(t.get_chunk(ChunkID{0})->get_segment(ColumnID{0})));
+  EXPECT_TRUE(t.get_chunk(ChunkID{1})->is_preallocated());
+
+  t.append_concurrently({3, "3"});
+  EXPECT_EQ(t.row_count(), 4u);
+  EXPECT_EQ(type_cast<int>((*t.get_chunk(ChunkID{1})->get_segment(ColumnID{0}))[1]), 3);
+}
+
+TEST_F(StorageTableTest, CompressWhileAppendingConcurrently) {
+  constexpr auto thread_count = 4;
+  constexpr auto rows_per_thread = 1000;
+  auto table = Table{10};
+  table.add_column("a", "int");
+
+  auto done = std::atomic_bool{false};
+  auto compressor = std::thread([&]() {
+    while (!done) table.compress_table();
+  });
+
+  std::vector<std::thread> threads;
+  for (auto thread_index = 0; thread_index < thread_count; ++thread_index) {
+    threads.emplace_back([&, thread_index]() {
+      for (auto row = 0; row < rows_per_thread; ++row) {
+        table.append_concurrently({thread_index * rows_per_thread + row});
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  done = true;
+  compressor.join();
+
+  // No row is lost, even if its chunk was compressed while the row was being written
+  ASSERT_EQ(table.row_count(), uint64_t{thread_count * rows_per_thread});
+  std::vector<int> values;
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    const auto segment = chunk->get_segment(ColumnID{0});
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      values.push_back(type_cast<int>((*segment)[chunk_offset]));
+    }
+  }
+  std::sort(values.begin(), values.end());
+  for (auto index = 0; index < thread_count * rows_per_thread; ++index) EXPECT_EQ(values[index], index);
+}
+
 }  // namespace opossum
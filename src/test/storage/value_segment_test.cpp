@@ -1,4 +1,6 @@
+#include <atomic>
 #include <limits>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -6,6 +8,7 @@
 #include "gtest/gtest.h"
 
 #include "../lib/storage/value_segment.hpp"
+#include "../lib/utils/memory_usage.hpp"
 
 namespace opossum {
 
@@ -55,20 +58,46 @@ TEST_F(StorageValueSegmentTest, AddValueOfDifferentType) {
 }
 
 TEST_F(StorageValueSegmentTest, MemoryUsage) {
+  EXPECT_EQ(int_value_segment.estimate_memory_usage(), sizeof(ValueSegment<int>));
   int_value_segment.append(1);
-  EXPECT_EQ(int_value_segment.estimate_memory_usage(), size_t{4});
   int_value_segment.append(2);
-  EXPECT_EQ(int_value_segment.estimate_memory_usage(), size_t{8});
+  int_value_segment.append(3);
+  // The unused capacity of the vector is counted as well
+  ASSERT_GT(int_value_segment.values().capacity(), 3u);
+  EXPECT_EQ(int_value_segment.estimate_memory_usage(),
+            sizeof(ValueSegment<int>) + int_value_segment.values().capacity() * sizeof(int));
 
+  // Short strings are stored inside of the std::string objects, longer ones on the heap
   string_value_segment.append("Hello");
-  EXPECT_EQ(string_value_segment.estimate_memory_usage(), sizeof(std::string));
   string_value_segment.append("World");
-  EXPECT_EQ(string_value_segment.estimate_memory_usage(), 2 * sizeof(std::string));
+  const auto string_bytes = sizeof(ValueSegment<std::string>) + 2 * sizeof(std::string);
+  EXPECT_EQ(string_value_segment.estimate_memory_usage(), string_bytes);
+  string_value_segment.append(std::string(100, 'x'));
+  EXPECT_EQ(string_value_segment.estimate_memory_usage(),
+            sizeof(ValueSegment<std::string>) + string_value_segment.values().capacity() * sizeof(std::string) +
+                string_value_segment.values()[2].capacity() + 1);
+  EXPECT_GE(string_value_segment.estimate_memory_usage(), string_bytes + sizeof(std::string) + 101);
 
   double_value_segment.append(3.14);
-  EXPECT_EQ(double_value_segment.estimate_memory_usage(), sizeof(double));
-  double_value_segment.append(42.0);
-  EXPECT_EQ(double_value_segment.estimate_memory_usage(), 2 * sizeof(double));
+  EXPECT_EQ(double_value_segment.estimate_memory_usage(), sizeof(ValueSegment<double>) + sizeof(double));
+}
+
+TEST_F(StorageValueSegmentTest, Preallocated) {
+  const auto published_size = std::make_shared<std::atomic<ChunkOffset>>(0);
+  auto segment = ValueSegment<int>{ChunkOffset{4}, published_size};
+  EXPECT_EQ(segment.size(), 0u);
+  EXPECT_EQ(segment.estimate_memory_usage(), sizeof(ValueSegment<int>) + 4 * sizeof(int));
+  EXPECT_THROW(segment.append(1), std::logic_error);
+
+  segment.set(ChunkOffset{1}, 5);
+  segment.set(ChunkOffset{0}, 3);
+  EXPECT_EQ(segment.compute_statistics(), nullptr);
+  published_size->store(2);
+  EXPECT_EQ(segment.size(), 2u);
+  const auto statistics = segment.compute_statistics();
+  ASSERT_TRUE(statistics);
+  EXPECT_EQ(statistics->min, AllTypeVariant{3});
+  EXPECT_EQ(statistics->max, AllTypeVariant{5});
 }
 
 }  // namespace opossum
@@ -0,0 +1,183 @@
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "resolve_type.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/fixed_size_attribute_vector.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/binary_table.hpp"
+
+namespace opossum {
+
+class BinaryTableTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(4);
+    _table->add_column("a", "int");
+    _table->add_column("b", "long");
+    _table->add_column("c", "float");
+    _table->add_column("d", "double");
+    _table->add_column("e", "string");
+    for (auto index = 0; index < 10; ++index) {
+      _table->append({index % 3, int64_t{index} * 1'000'000'000'000, index * 0.5f, index * 0.25,
+                      std::string(static_cast<size_t>(index), 'x')});
+    }
+
+    // One chunk of each kind: FixedSize dictionary, BitPacked dictionary, and values
+    _table->compress_chunk(ChunkID{0});
+    _table->compress_chunk(ChunkID{1}, AttributeVectorEncoding::BitPacked);
+  }
+
+  void TearDown() override { std::remove(_file_name.c_str()); }
+
+  std::shared_ptr<Table> _table;
+  const std::string _file_name = "binary_table_test.bin";
+};
+
+TEST_F(BinaryTableTest, SaveAndLoad) {
+  _table->save(_file_name);
+  const auto loaded_table = load_binary_table(_file_name);
+
+  EXPECT_EQ(loaded_table->max_chunk_size(), 4u);
+  EXPECT_EQ(loaded_table->chunk_count(), 3u);
+  EXPECT_EQ(loaded_table->column_names(), _table->column_names());
+  for (ColumnID column_id{0}; column_id < _table->column_count(); ++column_id) {
+    EXPECT_EQ(loaded_table->column_type(column_id), _table->column_type(column_id));
+  }
+  EXPECT_TABLE_EQ(loaded_table, _table, true);
+
+  // The segments are loaded as they were saved
+  const auto dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<int32_t>>(
+      loaded_table->get_chunk(ChunkID{1})->get_segment(ColumnID{0}));
+  ASSERT_TRUE(dictionary_segment);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const BitPackedAttributeVector>(dictionary_segment->attribute_vector()));
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<std::string>>(
+      loaded_table->get_chunk(ChunkID{0})->get_segment(ColumnID{4})));
+  EXPECT_TRUE(
+      std::dynamic_pointer_cast<ValueSegment<double>>(loaded_table->get_chunk(ChunkID{2})->get_segment(ColumnID{3})));
+
+  // The loaded table can still be appended to
+  loaded_table->append({1, int64_t{2}, 3.0f, 4.0, "five"});
+  EXPECT_EQ(loaded_table->row_count(), 11u);
+}
+
+TEST_F(BinaryTableTest, EncodedSegmentsReferenceTheMapping) {
+  _table->save(_file_name);
+  auto loaded_table = load_binary_table(_file_name);
+
+  const auto dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<int32_t>>(
+      loaded_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  ASSERT_TRUE(dictionary_segment);
+  EXPECT_TRUE(dictionary_segment->dictionary()->is_referencing());
+  const auto attribute_vector =
+      std::dynamic_pointer_cast<const FixedSizeAttributeVector<uint8_t>>(dictionary_segment->attribute_vector());
+  ASSERT_TRUE(attribute_vector);
+  EXPECT_TRUE(attribute_vector->values().is_referencing());
+  const auto string_segment = std::dynamic_pointer_cast<DictionarySegment<std::string>>(
+      loaded_table->get_chunk(ChunkID{0})->get_segment(ColumnID{4}));
+  ASSERT_TRUE(string_segment);
+  EXPECT_TRUE(string_segment->dictionary()->bytes().is_referencing());
+
+  // The mapping stays valid after the table is gone and the file is deleted
+  loaded_table = nullptr;
+  std::remove(_file_name.c_str());
+  EXPECT_EQ(dictionary_segment->get(ChunkOffset{2}), 2);
+  EXPECT_EQ(string_segment->get(ChunkOffset{3}), "xxx");
+}
+
+TEST_F(BinaryTableTest, RunLengthSegments) {
+  auto chunk = Chunk{};
+  for (ColumnID column_id{0}; column_id < _table->column_count(); ++column_id) {
+    const auto segment = _table->get_chunk(ChunkID{2})->get_segment(column_id);
+    resolve_data_type(_table->column_type(column_id), [&](auto type) {
+      using Type = typename decltype(type)::type;
+      chunk.add_segment(std::make_shared<RunLengthSegment<Type>>(segment));
+    });
+  }
+  auto table = std::make_shared<Table>(4);
+  for (ColumnID column_id{0}; column_id < _table->column_count(); ++column_id) {
+    table->add_column_definition(_table->column_name(column_id), _table->column_type(column_id));
+  }
+  table->emplace_chunk(std::move(chunk));
+
+  table->save(_file_name);
+  const auto loaded_table = load_binary_table(_file_name);
+  EXPECT_TABLE_EQ(loaded_table, table, true);
+  EXPECT_TRUE(std::dynamic_pointer_cast<RunLengthSegment<std::string>>(
+      loaded_table->get_chunk(ChunkID{0})->get_segment(ColumnID{4})));
+}
+
+TEST_F(BinaryTableTest, FrameOfReferenceSegments) {
+  // The ints are frame-of-reference encoded, the longs of each chunk are too far apart and fall back to dictionaries
+  _table->compress_chunk(ChunkID{2}, SegmentEncoding::FrameOfReference);
+  ASSERT_TRUE(std::dynamic_pointer_cast<FrameOfReferenceSegment<int32_t>>(
+      _table->get_chunk(ChunkID{2})->get_segment(ColumnID{0})));
+
+  _table->save(_file_name);
+  const auto loaded_table = load_binary_table(_file_name);
+  EXPECT_TABLE_EQ(loaded_table, _table, true);
+  EXPECT_TRUE(std::dynamic_pointer_cast<FrameOfReferenceSegment<int32_t>>(
+      loaded_table->get_chunk(ChunkID{2})->get_segment(ColumnID{0})));
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int64_t>>(
+      loaded_table->get_chunk(ChunkID{2})->get_segment(ColumnID{1})));
+}
+
+TEST_F(BinaryTableTest, EmptyTable) {
+  auto table = std::make_shared<Table>(2);
+  table->add_column("a", "int");
+  table->save(_file_name);
+
+  const auto loaded_table = load_binary_table(_file_name);
+  EXPECT_EQ(loaded_table->row_count(), 0u);
+  EXPECT_EQ(loaded_table->chunk_count(), 1u);
+  loaded_table->append({1});
+  EXPECT_EQ(loaded_table->row_count(), 1u);
+}
+
+TEST_F(BinaryTableTest, StorageManager) {
+  auto& storage_manager = StorageManager::get();
+  storage_manager.add_table("table", _table);
+  storage_manager.save_table("table", _file_name);
+  storage_manager.load_table("loaded_table", _file_name);
+  EXPECT_TABLE_EQ(storage_manager.get_table("loaded_table"), _table, true);
+}
+
+TEST_F(BinaryTableTest, RejectsInvalidFiles) {
+  EXPECT_THROW(load_binary_table("does_not_exist.bin"), std::logic_error);
+
+  std::ofstream(_file_name) << "this is not a table";
+  EXPECT_THROW(load_binary_table(_file_name), std::logic_error);
+
+  // A truncated file is detected as well
+  _table->save(_file_name);
+  std::string contents;
+  {
+    std::ifstream file(_file_name, std::ios::binary);
+    contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  }
+  std::ofstream(_file_name, std::ios::binary | std::ios::trunc) << contents.substr(0, contents.size() / 2);
+  EXPECT_THROW(load_binary_table(_file_name), std::logic_error);
+}
+
+TEST_F(BinaryTableTest, ReferenceTablesCannotBeSaved) {
+  auto table = std::make_shared<Table>();
+  table->add_column_definition("a", "int");
+  Chunk chunk;
+  chunk.add_segment(std::make_shared<ReferenceSegment>(_table, ColumnID{0}, std::make_shared<PosList>()));
+  table->emplace_chunk(std::move(chunk));
+  EXPECT_THROW(table->save(_file_name), std::logic_error);
+}
+
+}  // namespace opossum
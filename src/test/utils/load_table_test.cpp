@@ -0,0 +1,111 @@
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class LoadTableTest : public BaseTest {
+ protected:
+  void TearDown() override { std::remove(_file_name.c_str()); }
+
+  void _write_file(const std::string& contents) { std::ofstream(_file_name, std::ios::binary) << contents; }
+
+  const std::string _file_name = "load_table_test.tbl";
+};
+
+TEST_F(LoadTableTest, TblFile) {
+  const auto table = load_table("src/test/tables/int_float.tbl", 2);
+
+  auto expected_table = std::make_shared<Table>(2);
+  expected_table->add_column("a", "int");
+  expected_table->add_column("b", "float");
+  expected_table->append({12345, 458.7f});
+  expected_table->append({123, 456.7f});
+  expected_table->append({1234, 457.7f});
+
+  EXPECT_EQ(table->chunk_count(), 2u);
+  EXPECT_EQ(table->max_chunk_size(), 2u);
+  EXPECT_TABLE_EQ(table, expected_table, true);
+}
+
+TEST_F(LoadTableTest, CsvFileWithNames) {
+  _write_file("id,name,price\r\n1,apple,0.5\r\n2,,1.25\r\n\r\n3,cherry pie,-2\r\n");
+  const auto table = load_table(_file_name, 10, {',', TableFileHeader::Names, {"long", "string", "double"}});
+
+  auto expected_table = std::make_shared<Table>();
+  expected_table->add_column("id", "long");
+  expected_table->add_column("name", "string");
+  expected_table->add_column("price", "double");
+  expected_table->append({int64_t{1}, "apple", 0.5});
+  expected_table->append({int64_t{2}, "", 1.25});
+  expected_table->append({int64_t{3}, "cherry pie", -2.0});
+
+  EXPECT_TABLE_EQ(table, expected_table, true);
+}
+
+TEST_F(LoadTableTest, FileWithoutHeader) {
+  _write_file("1;a;\n2;b;");
+  const auto table = load_table(_file_name, 1, {';', TableFileHeader::None, {"int", "string"}});
+
+  EXPECT_EQ(table->column_name(ColumnID{0}), "column_0");
+  EXPECT_EQ(table->column_name(ColumnID{1}), "column_1");
+  EXPECT_EQ(table->chunk_count(), 2u);
+  EXPECT_EQ(table->row_count(), 2u);
+}
+
+TEST_F(LoadTableTest, EmptyFile) {
+  _write_file("a|b\nint|string\n");
+  const auto table = load_table(_file_name, 10);
+
+  EXPECT_EQ(table->row_count(), 0u);
+  EXPECT_EQ(table->column_count(), 2u);
+  table->append({1, "one"});
+  EXPECT_EQ(table->row_count(), 1u);
+}
+
+TEST_F(LoadTableTest, LargeFile) {
+  // Large enough to be split into several byte ranges that are parsed in parallel
+  auto expected_table = std::make_shared<Table>(1000);
+  expected_table->add_column("a", "int");
+  expected_table->add_column("b", "string");
+  std::string contents = "a|b\nint|string\n";
+  for (auto row = 0; row < 50'000; ++row) {
+    expected_table->append({row, std::to_string(row * 7)});
+    contents += std::to_string(row) + "|" + std::to_string(row * 7) + "\n";
+  }
+  _write_file(contents);
+
+  const auto table = load_table(_file_name, 1000);
+  EXPECT_EQ(table->chunk_count(), 50u);
+  EXPECT_TABLE_EQ(table, expected_table, true);
+}
+
+TEST_F(LoadTableTest, InvalidFiles) {
+  EXPECT_THROW(load_table("does_not_exist.tbl", 10), std::logic_error);
+
+  _write_file("a|b\nint|int\n1|x\n");
+  EXPECT_THROW(load_table(_file_name, 10), std::logic_error);
+
+  _write_file("a|b\nint|int\n1\n");
+  EXPECT_THROW(load_table(_file_name, 10), std::logic_error);
+
+  _write_file("a|b\nint|int\n1|2|3\n");
+  EXPECT_THROW(load_table(_file_name, 10), std::logic_error);
+
+  _write_file("a|b\nint\n");
+  EXPECT_THROW(load_table(_file_name, 10), std::logic_error);
+
+  // The types of a file without them have to be given
+  _write_file("a,b\n1,2\n");
+  EXPECT_THROW(load_table(_file_name, 10, {',', TableFileHeader::Names, {}}), std::logic_error);
+}
+
+}  // namespace opossum